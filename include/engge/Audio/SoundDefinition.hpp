@@ -1,4 +1,5 @@
 #pragma once
+#include <future>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -24,11 +25,24 @@ public:
 
   [[nodiscard]] std::string getPath() const { return m_path; };
 
+  /// @brief Reads and decodes the sound, waits for the decoding started by loadAsync if any.
   void load();
+  /// @brief Starts reading and decoding the sound on a worker thread.
+  void loadAsync();
+  /// @brief Indicates whether the sound has been decoded and can be played without waiting.
+  [[nodiscard]] bool isLoaded();
+  /// @brief Releases the decoded sound, it will be decoded again the next time it's played.
+  void unload();
+  /// @brief Gets the size of the sound data loaded, 0 if the sound is not loaded.
+  [[nodiscard]] size_t getMemory() const { return m_isLoaded ? m_size : 0; }
 
 private:
   std::string m_path;
   bool m_isLoaded{false};
-  ngf::SoundBuffer m_buffer;
+  std::unique_ptr<ngf::SoundBuffer> m_buffer;
+  std::future<void> m_loading; ///< decoding started by loadAsync
+  size_t m_size{0};            ///< size of the sound data read from the pack
+  uint64_t m_lastUse{0};       ///< when the sound has been played for the last time
+  bool m_isTransient{false};   ///< not referenced by the scripts, released once it's not used anymore
 };
 } // namespace ng
\ No newline at end of file
@@ -19,7 +19,10 @@ public:
   ~SoundId() final;
 
   std::shared_ptr<ng::SoundDefinition> getSoundDefinition() { return m_soundDefinition; }
+  /// @brief Gets the handle of the sound, null while the sound is waiting for its definition to be decoded.
   std::shared_ptr<ngf::SoundHandle> getSoundHandle() { return m_sound; }
+  /// @brief Sets the handle of a sound which has been started once its definition has been decoded.
+  void setSoundHandle(std::shared_ptr<ngf::SoundHandle> sound);
   [[nodiscard]] SoundCategory getSoundCategory() const { return m_category; }
 
   [[nodiscard]] bool isPlaying() const;
@@ -36,5 +39,6 @@ private:
   std::shared_ptr<ngf::SoundHandle> m_sound{};
   SoundCategory m_category;
   const int m_entityId{0};
+  bool m_stopped{false}; ///< indicates whether the sound has been stopped before being started
 };
 } // namespace ng
@@ -1,5 +1,6 @@
 #pragma once
 #include <array>
+#include <limits>
 #include <memory>
 #include <vector>
 #include "SoundCategory.hpp"
@@ -19,7 +20,10 @@ public:
   void setEngine(Engine *pEngine) { m_pEngine = pEngine; }
   [[nodiscard]] Engine *getEngine() const { return m_pEngine; }
 
-  std::shared_ptr<SoundDefinition> defineSound(const std::string &name);
+  /// @brief Defines a sound from a file of the pack.
+  ///
+  /// A transient sound is not referenced by the scripts, it's released once it's not played anymore.
+  std::shared_ptr<SoundDefinition> defineSound(const std::string &name, bool isTransient = false);
   std::shared_ptr<SoundId> playSound(std::shared_ptr<SoundDefinition> soundDefinition,
                                      int loopTimes = 1,
                                      const ngf::TimeSpan &fadeInTime = ngf::TimeSpan::Zero,
@@ -28,10 +32,17 @@ public:
                                          int loopTimes = 1,
                                          const ngf::TimeSpan &fadeInTime = ngf::TimeSpan::Zero,
                                          int id = 0);
+  /// @brief Plays a music.
+  ///
+  /// If the music is not decoded yet, it's decoded on a worker thread and it starts once it's decoded.
+  /// The decoded music is released when it stops.
   std::shared_ptr<SoundId> playMusic(std::shared_ptr<SoundDefinition> soundDefinition,
                                      int loopTimes = 1,
                                      const ngf::TimeSpan &fadeInTime = ngf::TimeSpan::Zero);
 
+  /// @brief Starts decoding a sound on a worker thread, so it can be played later without waiting.
+  void preload(const std::shared_ptr<SoundDefinition> &soundDefinition);
+
   void pauseAllSounds();
   void resumeAllSounds();
 
@@ -51,12 +62,28 @@ public:
   std::shared_ptr<SoundId> getSound(size_t index);
   std::vector<std::shared_ptr<SoundDefinition>> &getSoundDefinitions() { return m_sounds; }
   std::array<std::shared_ptr<SoundId>, 32> &getSounds() { return m_soundIds; }
+  /// @brief Gets a sound waiting for its definition to be decoded.
+  [[nodiscard]] SoundId *getPendingSound(int id) const;
 
   void setSoundHover(std::shared_ptr<SoundDefinition> sound) { m_pSoundHover = sound; }
   [[nodiscard]] std::shared_ptr<SoundDefinition> getSoundHover() const { return m_pSoundHover; }
 
   [[nodiscard]] size_t getSize() const { return m_soundIds.size(); }
 
+  /// @brief Sets the maximum memory used by the loaded sounds.
+  ///
+  /// When the sounds exceed the budget, the least recently played sounds which are not playing are released.
+  void setSoundBudget(size_t budget) { m_soundBudget = budget; }
+  [[nodiscard]] size_t getSoundBudget() const { return m_soundBudget; }
+  /// @brief Gets the memory used by the loaded sounds.
+  [[nodiscard]] size_t getSoundMemory() const { return m_soundMemory; }
+  /// @brief Gets the number of sounds played which were already loaded.
+  [[nodiscard]] int getHits() const { return m_hits; }
+  /// @brief Gets the number of sounds played which had to be loaded.
+  [[nodiscard]] int getMisses() const { return m_misses; }
+  /// @brief Gets the number of sounds released to respect the memory budget.
+  [[nodiscard]] int getEvictedSounds() const { return m_evictedSounds; }
+
   void update(const ngf::TimeSpan &elapsed);
 
 private:
@@ -65,9 +92,32 @@ private:
                                 int loopTimes = 1,
                                 const ngf::TimeSpan &fadeInTime = ngf::TimeSpan::Zero,
                                 int id = 0);
+  void updatePendingSounds();
+  void releaseMusic(const std::shared_ptr<SoundId> &soundId);
+  void onPlay(SoundDefinition &soundDefinition);
+  [[nodiscard]] bool isUsed(const std::shared_ptr<SoundDefinition> &soundDefinition) const;
+  /// @brief Indicates whether the sound is decoded and accounts its memory once its decoding is finished.
+  bool isLoaded(SoundDefinition &soundDefinition);
+  void load(SoundDefinition &soundDefinition);
+  void loadAsync(const std::shared_ptr<SoundDefinition> &soundDefinition);
+  void unload(SoundDefinition &soundDefinition);
+  void updateLoadingSounds();
+  void evictSounds();
+  void pruneSounds();
+
+private:
+  static constexpr size_t MinPruneSize = 256;
+
+  struct PendingSound {
+    std::shared_ptr<SoundId> soundId;
+    int loopTimes;
+    ngf::TimeSpan fadeInTime;
+  };
 
 private:
   std::vector<std::shared_ptr<SoundDefinition>> m_sounds;
+  std::vector<PendingSound> m_pendingSounds; ///< sounds started once their definition is decoded
+  std::vector<std::shared_ptr<SoundDefinition>> m_loadingSounds; ///< sounds decoded by a worker thread
   std::array<std::shared_ptr<SoundId>, 32> m_soundIds;
   Engine *m_pEngine{nullptr};
   float m_masterVolume{1};
@@ -75,5 +125,12 @@ private:
   float m_musicVolume{1};
   float m_talkVolume{1};
   std::shared_ptr<SoundDefinition> m_pSoundHover{nullptr};
+  size_t m_soundBudget{std::numeric_limits<size_t>::max()};
+  size_t m_soundMemory{0};
+  size_t m_pruneSize{MinPruneSize}; ///< number of sounds defined before releasing the transient sounds
+  uint64_t m_useCount{0};
+  int m_hits{0};
+  int m_misses{0};
+  int m_evictedSounds{0};
 };
 } // namespace ng
\ No newline at end of file
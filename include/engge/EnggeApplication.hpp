@@ -5,6 +5,7 @@
 #include <ngf/Graphics/RenderTarget.h>
 #include <ngf/Graphics/RenderStates.h>
 #include <engge/System/Services.hpp>
+#include <engge/System/StartupPipeline.hpp>
 #include <engge/Engine/Camera.hpp>
 #include <engge/Scripting/ScriptEngine.hpp>
 #include <glm/vec2.hpp>
@@ -33,5 +34,6 @@ private:
   bool m_isMousePressed{false};
   bool m_isKeyPressed{false};
   std::unique_ptr<DebugTools> m_debugTools;
+  std::unique_ptr<StartupPipeline> m_startup; ///< measures the startup until the first frame
 };
 }
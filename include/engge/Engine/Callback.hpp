@@ -3,24 +3,25 @@
 #include <vector>
 #include <squirrel.h>
 #include <ngf/System/TimeSpan.h>
-#include <engge/Engine/TimeFunction.hpp>
+#include <engge/System/NonCopyable.hpp>
 
 namespace ng {
-class Callback final : public TimeFunction {
+/// @brief Script method called once after a duration, it is scheduled by the engine timers.
+class Callback final : public NonCopyable {
 public:
   Callback(int id, ngf::TimeSpan duration, std::string method, HSQOBJECT arg);
-  ~Callback() final;
+  ~Callback();
 
   [[nodiscard]] int getId() const { return m_id; }
+  [[nodiscard]] ngf::TimeSpan getDuration() const { return m_duration; }
   [[nodiscard]] const std::string& getMethod() const { return m_method; }
   [[nodiscard]] HSQOBJECT getArgument() const { return m_arg; }
 
-private:
-  void onElapsed() final;
+  void call();
 
 private:
-  bool m_callbackDone{false};
   int m_id{0};
+  ngf::TimeSpan m_duration;
   std::string m_method{};
   HSQOBJECT m_arg;
 };
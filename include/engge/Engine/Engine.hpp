@@ -18,6 +18,7 @@ class DialogManager;
 class EnggeApplication;
 class Entity;
 class Function;
+class GGFont;
 class Inventory;
 class Object;
 class Preferences;
@@ -26,7 +27,9 @@ class ScriptExecute;
 class Sentence;
 class SoundDefinition;
 class SoundManager;
+class TimerQueue;
 class ResourceManager;
+class TextCache;
 class ThreadBase;
 struct Verb;
 class VerbExecute;
@@ -92,6 +95,8 @@ public:
   void removeCallback(int id);
 
   void addFunction(std::unique_ptr<Function> function);
+  /// @brief Gets the timers running an action after a delay, they are updated with the functions.
+  TimerQueue &getTimers();
   void cutscene(std::unique_ptr<Cutscene> function);
   [[nodiscard]] bool inCutscene() const;
   void cutsceneOverride();
@@ -122,6 +127,7 @@ public:
   [[nodiscard]] int getInputState() const;
 
   void setScriptExecute(std::unique_ptr<ScriptExecute> scriptExecute);
+  [[nodiscard]] const ScriptExecute *getScriptExecute() const;
 
   void addThread(std::unique_ptr<ThreadBase> thread);
   std::vector<std::unique_ptr<ThreadBase>> &getThreads();
@@ -139,6 +145,11 @@ public:
   SoundManager &getSoundManager();
   DialogManager &getDialogManager();
   ResourceManager &getResourceManager();
+  TextCache &getTextCache();
+
+  /// @brief Gets the font used to display the talks, the dialogs and the sentences.
+  /// @details The font depends on the retro fonts preference.
+  GGFont &getDefaultFont();
 
   Camera &getCamera();
   void follow(Actor *pActor);
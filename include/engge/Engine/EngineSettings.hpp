@@ -2,7 +2,9 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <filesystem>
+#include <unordered_map>
 #include <ngf/IO/GGPackValue.h>
 #include <ngf/IO/GGPack.h>
 
@@ -15,12 +17,16 @@ public:
 public:
   [[nodiscard]] std::filesystem::path getPath() const;
   void loadPacks();
+  /// @brief Scans the working directory for the files overriding the pack entries.
+  void scanOverrides();
 
   [[nodiscard]] int getPackCount() const { return static_cast<int>(m_packs.size()); }
 
   bool hasEntry(const std::string &name);
   [[nodiscard]] std::vector<char> readBuffer(const std::string &name) const;
   [[nodiscard]] ngf::GGPackValue readEntry(const std::string &name) const;
+  /// @brief Gets the last modification time of the pack or the override file containing an entry.
+  [[nodiscard]] std::filesystem::file_time_type getLastWriteTime(const std::string &name) const;
 
   iterator begin() { return m_packs.begin(); }
   iterator end() { return m_packs.end(); }
@@ -28,7 +34,15 @@ public:
   [[nodiscard]] const_iterator cbegin() const { return m_packs.cbegin(); }
   [[nodiscard]] const_iterator cend() const { return m_packs.cend(); }
 
+private:
+  [[nodiscard]] ngf::GGPack *findPack(const std::string &name) const;
+  [[nodiscard]] const std::filesystem::path *findOverride(const std::string &name) const;
+
 private:
   std::vector<std::unique_ptr<ngf::GGPack>> m_packs;
+  std::unordered_map<std::string, ngf::GGPack *> m_entries;           ///< pack containing each entry
+  std::unordered_map<std::string, std::filesystem::path> m_overrides; ///< loose files overriding the entries
+  std::unordered_map<const ngf::GGPack *, std::filesystem::path> m_packPaths;
+  mutable std::mutex m_packMutex;                                     ///< the packs can be read from the workers
 };
 } // namespace ng
@@ -38,6 +38,9 @@ static const std::string KeySelectNext = "keySelectNext";
 // engge only
 static const std::string EnggeGameSpeedFactor = "gameSpeedFactor";
 static const std::string EnggeDevPath = "devPath";
+static const std::string EnggeNativeRoomResolution = "nativeRoomResolution";
+static const std::string EnggeTextureMemoryBudget = "textureMemoryBudget";
+static const std::string EnggeSoundMemoryBudget = "soundMemoryBudget";
 static const bool EnggeDebug = false;
 }
 
@@ -73,6 +76,9 @@ static const std::string KeySelectNext = "0";
 static const bool AnnoyingInJokes = false;
 static const std::string EnggeDevPath = "";
 static const float EnggeGameSpeedFactor = 1.f;
+static const bool EnggeNativeRoomResolution = false;
+static const int EnggeTextureMemoryBudget = 512; ///< in MB
+static const int EnggeSoundMemoryBudget = 64;    ///< in MB
 static const bool EnggeDebug = false;
 }
 
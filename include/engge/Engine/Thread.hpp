@@ -7,6 +7,7 @@
 namespace ng {
 class Thread final : public ThreadBase {
 public:
+  /// @brief Creates a thread running a closure, it takes the ownership of thread_obj acquired from the thread VM pool.
   Thread(std::string  name, bool isGlobal,
          HSQUIRRELVM v,
          HSQOBJECT thread_obj,
@@ -26,9 +26,14 @@ public:
   [[nodiscard]] bool isSuspended() const;
   [[nodiscard]] virtual bool isStopped() const;
 
+  /// @brief Indicates that a call or a resume of the coroutine failed, its VM is not reused.
+  void setFailed() { m_hasFailed = true; }
+  [[nodiscard]] bool hasFailed() const { return m_hasFailed; }
+
 private:
   bool m_isSuspended{false};
   bool m_isPauseable{true};
   bool m_isStopped{false};
+  bool m_hasFailed{false};
 };
 }
@@ -0,0 +1,61 @@
+#pragma once
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+#include <ngf/System/TimeSpan.h>
+#include <engge/System/NonCopyable.hpp>
+
+namespace ng {
+/// @brief Runs actions after a delay, only the due actions are touched at each update.
+///
+/// The timers are kept in a min-heap sorted by due time, a cancelled timer is
+/// removed from the heap lazily when it becomes due.
+class TimerQueue : public NonCopyable {
+public:
+  using Action = std::function<void()>;
+
+  /// @brief Schedules an action to run after a delay.
+  ///
+  /// It can be called by a running action, the new action runs at the next update at the earliest.
+  /// \param delay Delay after which the action runs.
+  /// \param action Action to run.
+  /// \return The id of the timer, used to cancel it.
+  int schedule(const ngf::TimeSpan &delay, Action action);
+  /// @brief Cancels a timer, nothing happens if it has already run.
+  /// \param id Id of the timer.
+  void cancel(int id);
+  /// @brief Gets the time remaining before a timer runs.
+  /// \param id Id of the timer.
+  /// \return The time remaining or 0 if the timer does not exist anymore.
+  [[nodiscard]] ngf::TimeSpan getRemainingTime(int id) const;
+  /// @brief Cancels all the timers.
+  void clear();
+
+  /// @brief Advances the time and runs the actions which are due.
+  /// \param elapsed Time elapsed since the last update.
+  void update(const ngf::TimeSpan &elapsed);
+
+  /// @brief Gets the number of timers scheduled.
+  [[nodiscard]] size_t getSize() const { return m_timers.size(); }
+
+private:
+  struct DueTime {
+    ngf::TimeSpan time;
+    int id;
+
+    bool operator>(const DueTime &other) const { return time > other.time; }
+  };
+
+  struct Timer {
+    ngf::TimeSpan time;
+    Action action;
+  };
+
+private:
+  ngf::TimeSpan m_time;
+  int m_nextId{1};
+  std::priority_queue<DueTime, std::vector<DueTime>, std::greater<>> m_dueTimes;
+  std::unordered_map<int, Timer> m_timers;
+};
+} // namespace ng
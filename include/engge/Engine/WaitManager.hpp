@@ -0,0 +1,72 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <engge/System/NonCopyable.hpp>
+
+namespace ng {
+/// @brief Event a suspended thread can wait for.
+enum class WaitEvent {
+  Walk,      ///< an actor stopped walking
+  Talk,      ///< an actor or an object stopped talking
+  Sound,     ///< a sound stopped
+  Thread,    ///< a thread ended
+  Animation, ///< an animation stopped playing or changed
+  Camera     ///< the camera arrived to its target
+};
+
+/// @brief Resumes the suspended threads when the event they wait for happens.
+///
+/// The sources of the events notify their state changes, only the threads
+/// waiting for these sources are checked, the others cost nothing per frame.
+class WaitManager : public NonCopyable {
+public:
+  /// @brief Condition checked when the event happens, the thread is resumed when it returns true.
+  using Condition = std::function<bool()>;
+
+  /// @brief Registers a suspended thread waiting for an event.
+  ///
+  /// The condition is checked once at the next update, in case the event already happened.
+  /// A thread waits for one event at a time, its previous wait is cancelled.
+  /// \param event Event to wait for.
+  /// \param sourceId Id of the entity, sound or thread sending the event, 0 to wait for any source.
+  /// \param threadId Id of the suspended thread.
+  /// \param condition Condition to check when the event happens.
+  void wait(WaitEvent event, int sourceId, int threadId, Condition condition);
+  /// @brief Notifies that the state of a source changed.
+  ///
+  /// The waiting threads are resumed at the next update, not during the call,
+  /// so that a script never runs in the middle of the update of an entity.
+  /// \param event Event sent.
+  /// \param sourceId Id of the entity, sound or thread sending the event.
+  void notify(WaitEvent event, int sourceId);
+  /// @brief Resumes the threads waiting for the events notified since the last update.
+  void update();
+  /// @brief Cancels the wait of a thread, when it's stopped for example.
+  /// \param threadId Id of the thread.
+  void cancel(int threadId);
+  /// @brief Cancels all the waits, when a savegame is loaded for example.
+  void clear();
+
+  /// @brief Gets the number of threads currently waiting for an event.
+  [[nodiscard]] size_t getNumWaits() const;
+
+private:
+  using Key = uint64_t;
+
+  struct Wait {
+    Key key;
+    Condition condition;
+  };
+
+private:
+  static Key getKey(WaitEvent event, int sourceId);
+  void removeWaiter(Key key, int threadId);
+
+private:
+  std::unordered_map<int, Wait> m_waits;                ///< wait of each suspended thread
+  std::unordered_map<Key, std::vector<int>> m_waiters;  ///< threads waiting for each event
+  std::vector<Key> m_notified;
+};
+} // namespace ng
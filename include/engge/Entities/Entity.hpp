@@ -33,6 +33,9 @@ public:
 
   virtual void update(const ngf::TimeSpan &elapsed);
   [[nodiscard]] virtual int getZOrder() const = 0;
+  /// @brief Indicates whether or not the z-order may have changed since the last call to resetZOrderChanged.
+  [[nodiscard]] bool hasZOrderChanged() const;
+  void resetZOrderChanged();
 
   void setName(const std::string &name);
   [[nodiscard]] std::string getName() const;
@@ -128,6 +131,7 @@ private:
 
 protected:
   [[nodiscard]] std::vector<Entity *> getChildren() const;
+  void setZOrderChanged();
 
 private:
   struct Impl;
@@ -6,6 +6,9 @@
 namespace ng {
 class AnimControl {
 public:
+  /// @brief Sets the id of the entity owning this control, used to notify when the animation stops.
+  void setId(int id) { m_id = id; }
+
   void setAnimation(Animation *anim);
   Animation *getAnimation();
 
@@ -27,9 +30,11 @@ private:
 
 private:
   static void trig(const Animation &animation);
+  void notifyStopped() const;
 
 private:
   Animation *m_anim{nullptr};
   bool m_loop{false};
+  int m_id{0};
 };
 }
\ No newline at end of file
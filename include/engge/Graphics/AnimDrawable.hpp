@@ -5,12 +5,14 @@
 
 namespace ng {
 struct Animation;
+class SpriteBatch;
 
 class AnimDrawable {
 public:
   void setAnim(const Animation *anim);
   void setFlipX(bool flipX);
   void setColor(const ngf::Color &color);
+  void setSpriteBatch(SpriteBatch *pBatch);
 
   void draw(const glm::vec2 &pos, ngf::RenderTarget &target, ngf::RenderStates states) const;
 
@@ -24,5 +26,6 @@ private:
   const Animation *m_anim{nullptr};
   bool m_flipX{false};
   ngf::Color m_color{ngf::Colors::White};
+  SpriteBatch *m_pBatch{nullptr};
 };
 }
\ No newline at end of file
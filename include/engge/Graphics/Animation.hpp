@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <functional>
+#include <memory>
 #include <vector>
 #include <glm/vec2.hpp>
 #include <ngf/Graphics/Texture.h>
@@ -12,6 +13,7 @@ namespace ng {
 struct Animation {
   std::string name;
   std::string texture;
+  mutable std::shared_ptr<ngf::Texture> pTexture; ///< texture resolved from its name the first time it's drawn
   std::vector<SpriteSheetItem> frames;
   std::vector<Animation> layers;
   std::vector<glm::ivec2> offsets;
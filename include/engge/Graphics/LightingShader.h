@@ -1,6 +1,9 @@
 #pragma once
 #include <array>
+#include <optional>
+#include <vector>
 #include <ngf/Graphics/Color.h>
+#include <ngf/Graphics/Rect.h>
 #include <ngf/Graphics/Shader.h>
 #include <ngf/Graphics/Texture.h>
 #include <engge/Engine/Light.hpp>
@@ -9,6 +12,7 @@ namespace ng {
 class LightingShader final : public ngf::Shader {
 public:
   static constexpr int MaxLights = 50;
+  static constexpr int MaxLightsPerSprite = 8;
 
 public:
   LightingShader();
@@ -25,10 +29,73 @@ public:
   void setNumberLights(int numberLights);
   [[nodiscard]] int getNumberLights() const;
 
-  void setLights(const std::array<Light, MaxLights> &lights);
+  /// @brief Prepares the uniforms of the lights which are on, it has to be called when a light is modified.
+  /// \param lights Lights of the room.
+  /// \param numberLights Number of lights used in the array.
+  void setLights(const std::array<Light, MaxLights> &lights, int numberLights);
+
+  /// @brief Selects the lights reaching a sprite and sends them to the shader.
+  ///
+  /// Only the lights whose cutoff circle intersects the sprite are kept, when there are
+  /// more than MaxLightsPerSprite lights, the nearest ones are selected.
+  /// \param bounds Bounds of the sprite in the lights coordinates.
+  /// \return The number of lights selected for this sprite.
+  int selectLights(const ngf::frect &bounds);
+
+  /// @brief Gets the number of uniform uploads sent to the GPU since the last reset.
+  [[nodiscard]] int getIssuedUploads() const { return m_issuedUploads; }
+  /// @brief Gets the number of uniform uploads skipped because the value didn't change since the last reset.
+  [[nodiscard]] int getSkippedUploads() const { return m_skippedUploads; }
+  void resetUploadStats();
+
+private:
+  struct LightUniforms {
+    glm::vec3 pos;
+    glm::vec2 coneDirection;
+    float coneCosineHalfConeAngle;
+    float coneFalloff;
+    ngf::Color color;
+    float brightness;
+    float cutoffRadius;
+    float halfRadius;
+  };
+
+  void updateNumberLights();
+
+  template<typename T>
+  bool needsUpload(std::optional<T> &uploaded, const T &value) {
+    if (uploaded && *uploaded == value) {
+      m_skippedUploads++;
+      return false;
+    }
+    uploaded = value;
+    m_issuedUploads++;
+    return true;
+  }
 
 private:
   int m_numberLights{0};
+  int m_selectedLights{0};
+  std::vector<LightUniforms> m_lights;
+  std::vector<const LightUniforms *> m_lightsInRange;
+  std::vector<const LightUniforms *> m_uploadedLights; ///< lights selected when the arrays were sent
+  bool m_lightsChanged{true};
   ngf::Color m_ambient{ngf::Colors::White};
+  std::optional<glm::vec2> m_contentSize;
+  std::optional<glm::vec2> m_spritePosInSheet;
+  std::optional<glm::vec2> m_spriteSizeRelToSheet;
+  std::optional<glm::vec2> m_spriteOffset;
+  std::optional<ngf::Color> m_ambientUniform;
+  std::optional<int> m_numberLightsUniform;
+  std::optional<std::array<glm::vec3, MaxLightsPerSprite>> m_lightPos;
+  std::optional<std::array<glm::vec2, MaxLightsPerSprite>> m_coneDirection;
+  std::optional<std::array<float, MaxLightsPerSprite>> m_coneCosineHalfConeAngle;
+  std::optional<std::array<float, MaxLightsPerSprite>> m_coneFalloff;
+  std::optional<std::array<ngf::Color, MaxLightsPerSprite>> m_lightColor;
+  std::optional<std::array<float, MaxLightsPerSprite>> m_brightness;
+  std::optional<std::array<float, MaxLightsPerSprite>> m_cutoffRadius;
+  std::optional<std::array<float, MaxLightsPerSprite>> m_halfRadius;
+  int m_issuedUploads{0};
+  int m_skippedUploads{0};
 };
 }
@@ -1,7 +1,13 @@
 #pragma once
+#include <atomic>
+#include <future>
+#include <limits>
 #include <map>
 #include <memory>
+#include <set>
 #include <engge/System/NonCopyable.hpp>
+#include <engge/System/ThreadPool.hpp>
+#include <ngf/Graphics/Image.h>
 #include <ngf/Graphics/Texture.h>
 
 namespace ngf {
@@ -15,9 +21,37 @@ class SpriteSheet;
 struct TextureResource {
   std::shared_ptr<ngf::Texture> texture;
   size_t size;
+  size_t memory{0};    ///< memory used by the texture in video memory
+  uint64_t lastUse{0}; ///< when the texture has been requested for the last time
 };
 
+/// @brief Handle of a resource requested asynchronously.
+template<typename T>
+class ResourceHandle {
+public:
+  ResourceHandle() = default;
+  explicit ResourceHandle(std::shared_ptr<std::shared_ptr<T>> pResource) : m_pResource(std::move(pResource)) {}
+
+  /// @brief Indicates whether or not the resource has been loaded.
+  [[nodiscard]] bool isReady() const { return m_pResource && *m_pResource; }
+  /// @brief Gets the resource or nullptr if it's not ready yet.
+  [[nodiscard]] std::shared_ptr<T> get() const { return m_pResource ? *m_pResource : nullptr; }
+
+private:
+  std::shared_ptr<std::shared_ptr<T>> m_pResource;
+};
+
+using TextureHandle = ResourceHandle<ngf::Texture>;
+using SpriteSheetHandle = ResourceHandle<SpriteSheet>;
+
 class ResourceManager : public NonCopyable {
+public:
+  /// @brief Image decoded by a worker, its texture has to be created by the main thread.
+  struct DecodedImage {
+    ngf::Image image;
+    size_t size{0};
+  };
+
 public:
   ResourceManager();
   ~ResourceManager();
@@ -27,9 +61,85 @@ public:
   ngf::FntFont &getFntFont(const std::string &id);
   const SpriteSheet &getSpriteSheet(const std::string &id);
 
+  /// @brief Requests a texture to be loaded in the background.
+  ///
+  /// The image is read and decoded by the workers, the texture is created by update.
+  /// \param id Name of the texture.
+  /// \param priority Priority of the loading, the textures which are not needed yet should have a low priority.
+  /// A texture requested with a low priority is promoted when it's requested again with a normal priority.
+  /// \return A handle to the texture, ready once the texture has been created,
+  /// or an empty handle if the texture has already failed to load.
+  TextureHandle requestTexture(const std::string &id, JobPriority priority = JobPriority::Normal);
+  /// @brief Cancels the texture requests with a given priority which are not started yet.
+  ///
+  /// This is used to drop the textures prefetched for rooms which are not adjacent anymore.
+  /// \param priority Priority of the requests to cancel.
+  void cancelTextureRequests(JobPriority priority);
+  /// @brief Requests a sprite sheet to be loaded in the background, its texture is requested once it's loaded.
+  /// \param id Name of the sprite sheet.
+  /// \return A handle to the sprite sheet.
+  SpriteSheetHandle requestSpriteSheet(const std::string &id);
+  /// @brief Finishes the requests loaded by the workers, this has to be called by the main thread.
+  ///
+  /// When the textures exceed the memory budget, the least recently used textures
+  /// which are neither pinned nor owned outside of the resource manager are evicted.
+  void update();
+
+  /// @brief Pins a texture, a pinned texture is never evicted even if it's not loaded yet.
+  ///
+  /// This is used to keep the textures of the current room resident. A texture can be pinned several times,
+  /// it's unpinned once unpinTexture has been called as many times.
+  /// \param id Name of the texture.
+  void pinTexture(const std::string &id);
+  /// @brief Unpins a texture pinned with pinTexture.
+  /// \param id Name of the texture.
+  void unpinTexture(const std::string &id);
+
+  /// @brief Sets the maximum memory used by the textures.
+  void setTextureBudget(size_t budget) { m_textureBudget = budget; }
+  [[nodiscard]] size_t getTextureBudget() const { return m_textureBudget; }
+  /// @brief Gets the memory used by the resident textures.
+  [[nodiscard]] size_t getTextureMemory() const { return m_textureMemory; }
+  /// @brief Gets the number of textures evicted to respect the memory budget.
+  [[nodiscard]] int getEvictedTextures() const { return m_evictedTextures; }
+  /// @brief Gets the number of textures loaded again after having been evicted.
+  [[nodiscard]] int getReloadedTextures() const { return m_reloadedTextures; }
+
   [[nodiscard]] const std::map<std::string, TextureResource> &getTextureMap() const { return m_textureMap; }
 
+  /// @brief Reads and decodes the image of a texture, this can be called by any thread.
+  static DecodedImage decodeImage(const std::string &id);
+  /// @brief Creates a texture from an image decoded by decodeImage, if it's not already loaded.
+  void addDecodedTexture(const std::string &id, const DecodedImage &decodedImage);
+  /// @brief Adds a sprite sheet loaded by another thread, if it's not already loaded.
+  void addSpriteSheet(const std::string &id, std::shared_ptr<SpriteSheet> spriteSheet);
+
+private:
+  /// @brief Decoding of an image, it can be queued several times but only the first job started decodes it.
+  struct ImageDecoding {
+    std::atomic_bool started{false};
+    std::promise<DecodedImage> image;
+  };
+
+  struct PendingTexture {
+    std::shared_ptr<ImageDecoding> pDecoding;
+    std::shared_future<DecodedImage> image;
+    JobPriority priority{JobPriority::Normal};
+    std::shared_ptr<std::shared_ptr<ngf::Texture>> pTexture;
+  };
+
+  struct PendingSpriteSheet {
+    std::future<std::shared_ptr<SpriteSheet>> spriteSheet;
+    std::shared_ptr<std::shared_ptr<SpriteSheet>> pSpriteSheet;
+  };
+
 private:
+  std::shared_ptr<ngf::Texture> addTexture(const std::string &id, const DecodedImage &decodedImage);
+  static void decode(const std::string &id, ImageDecoding &decoding);
+  static void enqueueDecoding(const std::string &id, PendingTexture &request, JobPriority priority);
+  std::shared_ptr<ngf::Texture> finishTexture(const std::string &id);
+  void evictTextures();
+  std::shared_ptr<SpriteSheet> finishSpriteSheet(const std::string &id);
   void load(const std::string &id);
   void loadFont(const std::string &id);
   void loadFntFont(const std::string &id);
@@ -40,5 +150,15 @@ private:
   std::map<std::string, std::shared_ptr<GGFont>> m_fontMap;
   std::map<std::string, std::shared_ptr<ngf::FntFont>> m_fntFontMap;
   std::map<std::string, std::shared_ptr<SpriteSheet>> m_spriteSheetMap;
+  std::map<std::string, PendingTexture> m_pendingTextures;
+  std::map<std::string, PendingSpriteSheet> m_pendingSpriteSheets;
+  std::set<std::string> m_evictedTextureNames;
+  std::set<std::string> m_failedTextureNames; ///< textures which failed to load, they are not requested again
+  std::map<std::string, int> m_pinnedTextures;  ///< number of times each texture has been pinned
+  size_t m_textureBudget{std::numeric_limits<size_t>::max()};
+  size_t m_textureMemory{0};
+  uint64_t m_useCount{0};
+  int m_evictedTextures{0};
+  int m_reloadedTextures{0};
 };
 } // namespace ng
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+#include <vector>
+#include <glm/mat3x3.hpp>
+#include <ngf/Graphics/Color.h>
+#include <ngf/Graphics/Rect.h>
+#include <ngf/Graphics/RenderTarget.h>
+#include <ngf/Graphics/Texture.h>
+
+namespace ng {
+class LightingShader;
+
+/// @brief Collects unlit sprites sharing the same texture and lighting state and draws them at once.
+///
+/// The per-sprite lighting uniforms are only used by the lighting shader when lights are enabled,
+/// so only sprites drawn without lights can be batched. The other sprites have to flush the batch
+/// before being drawn to preserve the draw order.
+class SpriteBatch {
+public:
+  /// @brief Adds a sprite to the batch, the batch is flushed first if the texture or the lighting state changed.
+  /// \param target Target where the sprite will be drawn.
+  /// \param shader Lighting shader used to draw the sprite.
+  /// \param texture Texture of the sprite.
+  /// \param rect Rectangle of the sprite in the texture.
+  /// \param transform Transform of the sprite.
+  /// \param color Color of the sprite.
+  void draw(ngf::RenderTarget &target, LightingShader &shader, const ngf::Texture &texture,
+            const ngf::irect &rect, const glm::mat3 &transform, const ngf::Color &color);
+
+  /// @brief Draws all the pending sprites.
+  void flush();
+
+  /// @brief Indicates whether or not a sprite is in the view of the target, and counts it as drawn or culled.
+  /// \param target Target where the sprite would be drawn.
+  /// \param rect Rectangle of the sprite in the texture.
+  /// \param transform Transform of the sprite.
+  /// \return true if the sprite is at least partially visible.
+  bool isVisible(const ngf::RenderTarget &target, const ngf::irect &rect, const glm::mat3 &transform);
+
+  /// @brief Gets the number of sprites found visible since the last call to resetStats.
+  [[nodiscard]] int getDrawnSprites() const { return m_drawnSprites; }
+  /// @brief Gets the number of sprites culled since the last call to resetStats.
+  [[nodiscard]] int getCulledSprites() const { return m_culledSprites; }
+  /// @brief Resets the drawn and culled sprites counters.
+  void resetStats();
+
+private:
+  std::vector<ngf::Vertex> m_vertices;
+  ngf::RenderTarget *m_pTarget{nullptr};
+  LightingShader *m_pShader{nullptr};
+  const ngf::Texture *m_pTexture{nullptr};
+  ngf::Color m_ambient{ngf::Colors::White};
+  int m_drawnSprites{0};
+  int m_culledSprites{0};
+};
+}
@@ -1,7 +1,9 @@
 #pragma once
+#include <cstdint>
 #include <string>
-#include <map>
+#include <string_view>
 #include <memory>
+#include <vector>
 #include "ResourceManager.hpp"
 #include "SpriteSheetItem.h"
 
@@ -18,11 +20,26 @@ public:
   [[nodiscard]] glm::ivec2 getSourceSize(const std::string &name) const;
   [[nodiscard]] SpriteSheetItem getItem(const std::string &name) const;
 
+private:
+  /// @brief Frame of the sprite sheet, this is also how a frame is stored in the cache file.
+  struct Frame {
+    uint32_t nameOffset; ///< offset of the name in the names buffer
+    uint32_t nameLength;
+    int32_t frame[4];    ///< x, y, width, height
+    int32_t spriteSourceSize[4];
+    int32_t sourceSize[2];
+  };
+
+  void loadJson(const std::string &jsonFilename);
+  bool loadCache(const std::string &path, int64_t time);
+  void saveCache(const std::string &path, int64_t time) const;
+  [[nodiscard]] std::string_view getName(const Frame &frame) const;
+  [[nodiscard]] const Frame *getFrame(const std::string &name) const;
+
 private:
   ResourceManager *m_pResourceManager{nullptr};
-  std::map<std::string, ngf::irect> m_rects;
-  std::map<std::string, ngf::irect> m_spriteSourceSize;
-  std::map<std::string, glm::ivec2> m_sourceSize;
+  std::vector<Frame> m_frames; ///< frames sorted by name
+  std::string m_names;
   std::string m_textureName;
 };
 } // namespace ng
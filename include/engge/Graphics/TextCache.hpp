@@ -0,0 +1,35 @@
+#pragma once
+#include <map>
+#include <string>
+#include <tuple>
+#include <ngf/Graphics/Color.h>
+#include <ngf/Graphics/Font.h>
+#include <engge/Graphics/Text.hpp>
+
+namespace ng {
+/// @brief Keeps the texts drawn every frame with their layout.
+///
+/// A text is laid out only once as long as it is requested with the same
+/// string, font, color and max width at least once between two purges.
+class TextCache {
+public:
+  /// @brief Gets a text laid out with the specified parameters.
+  /// \param string String of the text.
+  /// \param font Font used to draw the text.
+  /// \param color Color of the text.
+  /// \param maxWidth Max width of the text before wrapping it, 0 to disable wrapping.
+  /// \return The text ready to be positioned and drawn.
+  ng::Text &get(const std::wstring &string, const ngf::Font &font, const ngf::Color &color, float maxWidth = 0.f);
+
+  /// @brief Removes the texts which have not been requested since the last purge.
+  void purge();
+
+private:
+  using Key = std::tuple<std::wstring, const ngf::Font *, float, float, float, float, float>;
+  struct Entry {
+    ng::Text text;
+    bool used{true};
+  };
+  std::map<Key, Entry> m_texts;
+};
+}
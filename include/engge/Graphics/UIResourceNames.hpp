@@ -0,0 +1,20 @@
+#pragma once
+#include <array>
+#include <string>
+
+namespace ng {
+/// @brief Names of the sprite sheets and the fonts used by the UI, they are loaded during the startup.
+namespace UIResourceNames {
+static const std::string GameSheet = "GameSheet";
+static const std::string VerbSheet = "VerbSheet";
+static const std::string SaveLoadSheet = "SaveLoadSheet";
+
+static const std::string UIFontSmallBold = "UIFontSmallBold.fnt";
+static const std::string UIFontMedium = "UIFontMedium.fnt";
+static const std::string UIFontLarge = "UIFontLarge.fnt";
+static const std::string HeadingFont = "HeadingFont.fnt";
+
+static const std::array<std::string, 3> SpriteSheets{GameSheet, VerbSheet, SaveLoadSheet};
+static const std::array<std::string, 4> Fonts{UIFontSmallBold, UIFontMedium, UIFontLarge, HeadingFont};
+}
+} // namespace ng
@@ -7,6 +7,7 @@
 #include <ngf/Graphics/Color.h>
 #include <engge/Scripting/ScriptObject.hpp>
 #include <engge/Graphics/LightingShader.h>
+#include <engge/Graphics/SpriteBatch.hpp>
 
 namespace ngf {
 class Walkbox;
@@ -45,12 +46,25 @@ public:
   void setName(const std::string &name);
   [[nodiscard]] std::string getName() const;
 
+  /// @brief Loads the objects and the scalings of the room, the rest is loaded by ensureLoaded.
   void load(const char *name);
+  /// @brief Loads the backgrounds, the layers and the walkboxes of the room if it's not already done.
+  void ensureLoaded();
+  /// @brief Reads the room file in the background to make the next call to ensureLoaded faster.
+  void warmUp();
   std::vector<std::unique_ptr<Object>> &getObjects();
   [[nodiscard]] const std::vector<std::unique_ptr<Object>> &getObjects() const;
   [[nodiscard]] std::array<Light, LightingShader::MaxLights> &getLights();
   [[nodiscard]] int getNumberLights() const;
+  /// @brief Indicates that a light has been modified, the lights are sent again to the shader at the next draw.
+  void setLightsDirty();
   LightingShader& getLightingShader();
+  SpriteBatch &getSpriteBatch() const;
+  /// @brief Pins the textures of the layers and the objects, they are not evicted while the room is the current room.
+  void pinTextures();
+  /// @brief Unpins and releases the textures cached by the layers and the objects,
+  /// they are requested again when the room is drawn.
+  void releaseTextures();
 
   void update(const ngf::TimeSpan &elapsed);
   void draw(ngf::RenderTarget &target, const glm::vec2 &cameraPos) const;
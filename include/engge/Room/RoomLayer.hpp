@@ -3,6 +3,7 @@
 #include <ngf/Graphics/Texture.h>
 #include <engge/Entities/Entity.hpp>
 #include <engge/Graphics/SpriteSheetItem.h>
+#include <engge/Graphics/SpriteBatch.hpp>
 
 namespace ng {
 
@@ -12,6 +13,8 @@ public:
   ~RoomLayer() = default;
 
   void setTexture(const std::string &texture);
+  void releaseTexture() { m_texture.reset(); }
+  [[nodiscard]] const std::string &getTextureName() const { return m_textureName; }
   void setRoomSizeY(int roomSizeY) { m_roomSizeY = roomSizeY; }
   void setOffsetY(int offsetY) { m_offsetY = offsetY; }
 
@@ -29,14 +32,20 @@ public:
   void setEnabled(bool enabled) { m_enabled = enabled; }
   [[nodiscard]] bool isEnabled() const { return m_enabled; }
 
-  void draw(ngf::RenderTarget &target, ngf::RenderStates states) const;
+  void draw(ngf::RenderTarget &target, ngf::RenderStates states, SpriteBatch &batch) const;
   void drawForeground(ngf::RenderTarget &target, ngf::RenderStates states) const;
   void update(const ngf::TimeSpan &elapsed);
 
+private:
+  void sortEntities() const;
+
 private:
   std::string m_textureName;
+  mutable std::shared_ptr<ngf::Texture> m_texture;
   std::vector<SpriteSheetItem> m_backgrounds;
   std::vector<std::reference_wrapper<Entity>> m_entities;
+  mutable std::vector<std::reference_wrapper<Entity>> m_drawOrder;
+  mutable bool m_drawOrderChanged{false};
   glm::vec2 m_parallax{1, 1};
   int m_zsort{0};
   bool m_enabled{true};
@@ -6,6 +6,7 @@
 #include "../../../extlibs/squirrel/squirrel/sqobject.h"
 #include "engge/Engine/Engine.hpp"
 #include "engge/Engine/Interpolations.hpp"
+#include "engge/Scripting/ThreadVmPool.hpp"
 #include "engge/System/Logger.hpp"
 #include <sqstdaux.h>
 #include <sqstdio.h>
@@ -30,6 +31,8 @@ public:
   static Engine &getEngine();
 
   static HSQUIRRELVM getVm() { return m_vm; }
+  /// @brief Gets the pool of the VMs used by the coroutine threads.
+  static ThreadVmPool &getThreadVmPool() { return m_threadVmPool; }
 
   static SQObjectPtr toSquirrel(const std::string &value);
 
@@ -116,6 +119,7 @@ private:
 
 private:
   inline static HSQUIRRELVM m_vm{};
+  inline static ThreadVmPool m_threadVmPool;
   std::vector<std::unique_ptr<Pack>> m_packs;
   inline static std::vector<PrintCallback> m_errorCallbacks;
   inline static std::vector<PrintCallback> m_printCallbacks;
@@ -1,8 +1,18 @@
 #pragma once
+#include <cstddef>
 #include <string>
 
 namespace ng {
 class SoundDefinition;
+
+/// @brief Statistics of the cache of the compiled code.
+struct ScriptExecuteStats {
+  int hits{0};
+  int misses{0};
+  size_t size{0};     ///< number of compiled codes in the cache
+  size_t capacity{0}; ///< maximum number of compiled codes in the cache
+};
+
 class ScriptExecute {
 public:
   virtual ~ScriptExecute() = default;
@@ -10,5 +20,6 @@ public:
   virtual std::string executeDollar(const std::string &code) = 0;
   virtual bool executeCondition(const std::string &code) = 0;
   virtual SoundDefinition *getSoundDefinition(const std::string &name) = 0;
+  [[nodiscard]] virtual ScriptExecuteStats getStats() const { return {}; }
 };
 }
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include <squirrel.h>
+#include <engge/System/NonCopyable.hpp>
+
+namespace ng {
+/// @brief Recycles the VMs of the finished coroutine threads.
+///
+/// Creating a thread VM allocates its stack and its call stack,
+/// a VM is reused only when its coroutine ended without error and nothing else references it.
+class ThreadVmPool : public NonCopyable {
+public:
+  static constexpr size_t Capacity = 64;    ///< maximum number of idle VMs kept in the pool
+  static constexpr SQInteger StackSize = 1024;
+
+  /// @brief Gets a thread VM from the pool or creates a new one.
+  /// \param v VM owning the thread.
+  /// \return The thread, the caller owns a reference to it and has to give it back with release.
+  HSQOBJECT acquire(HSQUIRRELVM v);
+  /// @brief Gives back a thread VM to the pool, it is released if it can't be reused.
+  /// \param v VM owning the thread.
+  /// \param thread Thread acquired with acquire, it is reset.
+  /// \param hasFailed true if a call or a resume of the coroutine failed, the VM is released.
+  void release(HSQUIRRELVM v, HSQOBJECT &thread, bool hasFailed);
+  /// @brief Releases all the idle VMs.
+  /// \param v VM owning the threads.
+  void clear(HSQUIRRELVM v);
+
+  [[nodiscard]] size_t getSize() const { return m_threads.size(); }
+  [[nodiscard]] size_t getCreated() const { return m_created; }
+  [[nodiscard]] size_t getReused() const { return m_reused; }
+  [[nodiscard]] size_t getDiscarded() const { return m_discarded; }
+
+private:
+  static bool canReuse(HSQUIRRELVM v, HSQOBJECT thread);
+  static void reset(HSQUIRRELVM v, HSQOBJECT thread);
+
+private:
+  std::vector<HSQOBJECT> m_threads;
+  size_t m_created{0};
+  size_t m_reused{0};
+  size_t m_discarded{0}; ///< number of VMs released because they couldn't be reused or the pool was full
+};
+} // namespace ng
@@ -6,8 +6,10 @@
 #include "engge/Engine/EntityManager.hpp"
 #include "engge/Engine/Preferences.hpp"
 #include "engge/Engine/TextDatabase.hpp"
+#include "engge/Engine/WaitManager.hpp"
 #include "Locator.hpp"
 #include "Logger.hpp"
+#include "ThreadPool.hpp"
 #include "engge/Util/RandomNumberGenerator.hpp"
 
 namespace ng {
@@ -16,6 +18,7 @@ public:
   static void init() {
     ng::Locator<ng::Logger>::create();
     ng::info("Init services");
+    ng::Locator<ng::ThreadPool>::create();
     ng::Locator<ng::RandomNumberGenerator>::create();
     ng::Locator<ng::CommandManager>::create();
     ng::Locator<ng::AchievementManager>::create();
@@ -23,6 +26,7 @@ public:
     ng::Locator<ng::EngineSettings>::create().loadPacks();
     ng::Locator<ng::EntityManager>::create();
     ng::Locator<ng::SoundManager>::create();
+    ng::Locator<ng::WaitManager>::create();
     ng::Locator<ng::TextDatabase>::create();
     ng::Locator<ng::ResourceManager>::create();
   }
@@ -0,0 +1,53 @@
+#pragma once
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "NonCopyable.hpp"
+
+namespace ng {
+/// @brief Runs the startup steps, concurrently when they are independent, and measures them.
+class StartupPipeline : public NonCopyable {
+public:
+  StartupPipeline();
+
+  /// @brief Runs a task on a worker thread.
+  /// \param name Name of the task, used to wait for it and in the timings.
+  /// \param task Task to run, it must not access any graphics resource nor the script engine.
+  void run(const std::string &name, std::function<void()> task);
+  /// @brief Runs a task on the calling thread.
+  /// \param name Name of the task, used in the timings.
+  /// \param task Task to run.
+  void runOnMainThread(const std::string &name, const std::function<void()> &task);
+  /// @brief Waits for a task run on a worker thread.
+  ///
+  /// The exception thrown by the task is thrown again.
+  /// \param name Name of the task.
+  void wait(const std::string &name);
+  /// @brief Waits for all the tasks run on a worker thread.
+  void waitAll();
+
+  /// @brief Logs the time spent by each task and the time elapsed since the pipeline creation.
+  void logTimings();
+
+private:
+  struct Task {
+    std::string name;
+    std::shared_future<void> result;
+    bool mainThread{false};
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;
+  };
+
+private:
+  Task *getTask(const std::string &name);
+
+private:
+  std::chrono::steady_clock::time_point m_start;
+  std::vector<std::unique_ptr<Task>> m_tasks;
+  std::mutex m_mutex;
+};
+} // namespace ng
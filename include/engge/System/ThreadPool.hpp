@@ -0,0 +1,55 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "NonCopyable.hpp"
+
+namespace ng {
+enum class JobPriority {
+  Normal,
+  Low ///< the job runs only when there is no normal job waiting
+};
+
+/// @brief Runs jobs in the background on a fixed set of worker threads.
+class ThreadPool : public NonCopyable {
+public:
+  /// @brief Creates a pool with one worker per hardware thread, except the main one.
+  ThreadPool();
+  /// @brief Stops the workers, the jobs not started yet are discarded.
+  ~ThreadPool();
+
+  /// @brief Adds a job to run on a worker thread.
+  /// \param job Job to run, it must not access any graphics resource.
+  /// \param priority Priority of the job.
+  /// \return The future result of the job, it holds the exception thrown by the job if any.
+  template<typename TJob>
+  auto enqueue(TJob &&job, JobPriority priority = JobPriority::Normal) -> std::future<std::invoke_result_t<TJob>> {
+    using Result = std::invoke_result_t<TJob>;
+    auto pTask = std::make_shared<std::packaged_task<Result()>>(std::forward<TJob>(job));
+    auto result = pTask->get_future();
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto &jobs = priority == JobPriority::Normal ? m_jobs : m_lowPriorityJobs;
+      jobs.emplace_back([pTask] { (*pTask)(); });
+    }
+    m_condition.notify_one();
+    return result;
+  }
+
+private:
+  void run();
+
+private:
+  std::vector<std::thread> m_workers;
+  std::deque<std::function<void()>> m_jobs;
+  std::deque<std::function<void()>> m_lowPriorityJobs;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  bool m_stop{false};
+};
+} // namespace ng
@@ -1,7 +1,9 @@
+#include <chrono>
 #include <utility>
 #include "engge/Engine/EngineSettings.hpp"
 #include "engge/System/Locator.hpp"
 #include "engge/System/Logger.hpp"
+#include "engge/System/ThreadPool.hpp"
 #include "engge/Engine/EntityManager.hpp"
 #include "engge/Audio/SoundDefinition.hpp"
 
@@ -13,14 +15,56 @@ SoundDefinition::SoundDefinition(std::string path)
   m_id = Locator<EntityManager>::get().getSoundId();
 }
 
-SoundDefinition::~SoundDefinition() = default;
+SoundDefinition::~SoundDefinition() {
+  if (m_loading.valid()) {
+    m_loading.wait();
+  }
+}
 
 void SoundDefinition::load() {
   if (m_isLoaded)
     return;
+  if (m_loading.valid()) {
+    m_loading.get();
+    m_isLoaded = true;
+    return;
+  }
   auto buffer = Locator<EngineSettings>::get().readBuffer(m_path);
-  m_buffer.loadFromMemory(buffer.data(), buffer.size());
+  m_buffer = std::make_unique<ngf::SoundBuffer>();
+  m_buffer->loadFromMemory(buffer.data(), buffer.size());
+  m_size = buffer.size();
   m_isLoaded = true;
 }
 
+void SoundDefinition::loadAsync() {
+  if (m_isLoaded || m_loading.valid())
+    return;
+  // the buffer is not accessed by the main thread until the decoding is finished
+  m_loading = Locator<ThreadPool>::get().enqueue([this] {
+    auto buffer = Locator<EngineSettings>::get().readBuffer(m_path);
+    auto soundBuffer = std::make_unique<ngf::SoundBuffer>();
+    soundBuffer->loadFromMemory(buffer.data(), buffer.size());
+    m_buffer = std::move(soundBuffer);
+    m_size = buffer.size();
+  });
+}
+
+bool SoundDefinition::isLoaded() {
+  if (!m_isLoaded && m_loading.valid()
+      && m_loading.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+    load();
+  }
+  return m_isLoaded;
+}
+
+void SoundDefinition::unload() {
+  if (m_loading.valid()) {
+    m_loading.wait();
+    m_loading = {};
+  }
+  m_buffer.reset();
+  m_size = 0;
+  m_isLoaded = false;
+}
+
 } // namespace ng
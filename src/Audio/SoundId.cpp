@@ -23,7 +23,15 @@ SoundId::~SoundId() {
   m_sound.reset();
 }
 
+void SoundId::setSoundHandle(std::shared_ptr<ngf::SoundHandle> sound) {
+  m_sound = std::move(sound);
+  updateVolume();
+}
+
 void SoundId::updateVolume() {
+  if (!m_sound)
+    return;
+
   float entityVolume = 1.f;
   Entity *pEntity = m_entityId ? EntityManager::getScriptObjectFromId<Entity>(m_entityId) : nullptr;
 
@@ -61,10 +69,16 @@ void SoundId::update(const ngf::TimeSpan &) {
 }
 
 bool SoundId::isPlaying() const {
+  if (!m_sound)
+    return !m_stopped;
   return m_sound->get().getStatus() == ngf::AudioChannel::Status::Playing;
 }
 
 void SoundId::stop(const ngf::TimeSpan &fadeOutTime) {
+  if (!m_sound) {
+    m_stopped = true;
+    return;
+  }
   return m_sound->get().stop(fadeOutTime);
 }
 } // namespace ng
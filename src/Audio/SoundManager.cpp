@@ -1,7 +1,10 @@
+#include <algorithm>
 #include <memory>
+#include <unordered_set>
 #include <ngf/Audio/AudioSystem.h>
 #include <engge/Engine/Engine.hpp>
 #include <engge/Engine/EngineSettings.hpp>
+#include <engge/Engine/WaitManager.hpp>
 #include <engge/Entities/Entity.hpp>
 #include <engge/EnggeApplication.hpp>
 #include <engge/System/Locator.hpp>
@@ -19,11 +22,18 @@ std::shared_ptr<SoundId> SoundManager::getSound(size_t index) {
   return m_soundIds[index - 1];
 }
 
-std::shared_ptr<SoundDefinition> SoundManager::defineSound(const std::string &name) {
+std::shared_ptr<SoundDefinition> SoundManager::defineSound(const std::string &name, bool isTransient) {
   if (!Locator<EngineSettings>::get().hasEntry(name))
     return nullptr;
 
+  // a definition is created for each line said, release the old ones from time to time
+  if (m_sounds.size() >= m_pruneSize) {
+    pruneSounds();
+    m_pruneSize = std::max(MinPruneSize, 2 * m_sounds.size());
+  }
+
   auto sound = std::make_shared<SoundDefinition>(name);
+  sound->m_isTransient = isTransient;
   m_sounds.push_back(sound);
   return sound;
 }
@@ -45,7 +55,23 @@ std::shared_ptr<SoundId> SoundManager::playTalkSound(std::shared_ptr<SoundDefini
 std::shared_ptr<SoundId> SoundManager::playMusic(std::shared_ptr<SoundDefinition> soundDefinition,
                                                  int loopTimes,
                                                  const ngf::TimeSpan &fadeInTime) {
-  return play(soundDefinition, SoundCategory::Music, loopTimes, fadeInTime);
+  if (isLoaded(*soundDefinition))
+    return play(soundDefinition, SoundCategory::Music, loopTimes, fadeInTime);
+
+  // decoding a music takes too much time to be done by the main thread
+  trace("decode music {}", soundDefinition->getPath());
+  onPlay(*soundDefinition);
+  loadAsync(soundDefinition);
+  auto soundId = std::make_shared<SoundId>(*this, soundDefinition, nullptr, SoundCategory::Music);
+  m_pendingSounds.push_back({soundId, loopTimes, fadeInTime});
+  return soundId;
+}
+
+SoundId *SoundManager::getPendingSound(int id) const {
+  auto it = std::find_if(m_pendingSounds.cbegin(), m_pendingSounds.cend(), [id](const auto &pendingSound) {
+    return pendingSound.soundId->getId() == id;
+  });
+  return it == m_pendingSounds.cend() ? nullptr : it->soundId.get();
 }
 
 std::shared_ptr<SoundId> SoundManager::play(std::shared_ptr<SoundDefinition> soundDefinition,
@@ -53,9 +79,10 @@ std::shared_ptr<SoundId> SoundManager::play(std::shared_ptr<SoundDefinition> sou
                                             int loopTimes,
                                             const ngf::TimeSpan &fadeInTime,
                                             int id) {
-  soundDefinition->load();
+  onPlay(*soundDefinition);
+  load(*soundDefinition);
   auto
-      sound = m_pEngine->getApplication()->getAudioSystem().playSound(soundDefinition->m_buffer, loopTimes, fadeInTime);
+      sound = m_pEngine->getApplication()->getAudioSystem().playSound(*soundDefinition->m_buffer, loopTimes, fadeInTime);
   auto soundId = std::make_shared<SoundId>(*this, soundDefinition, sound, category, id);
   auto index = sound->get().getChannel();
   if (index == -1) {
@@ -76,14 +103,64 @@ std::shared_ptr<SoundId> SoundManager::play(std::shared_ptr<SoundDefinition> sou
   return soundId;
 }
 
+void SoundManager::preload(const std::shared_ptr<SoundDefinition> &soundDefinition) {
+  soundDefinition->m_lastUse = ++m_useCount;
+  loadAsync(soundDefinition);
+}
+
+void SoundManager::onPlay(SoundDefinition &soundDefinition) {
+  if (isLoaded(soundDefinition)) {
+    m_hits++;
+  } else {
+    m_misses++;
+  }
+  soundDefinition.m_lastUse = ++m_useCount;
+}
+
+bool SoundManager::isLoaded(SoundDefinition &soundDefinition) {
+  if (soundDefinition.m_isLoaded)
+    return true;
+  if (!soundDefinition.isLoaded())
+    return false;
+  m_soundMemory += soundDefinition.getMemory();
+  return true;
+}
+
+void SoundManager::load(SoundDefinition &soundDefinition) {
+  if (soundDefinition.m_isLoaded)
+    return;
+  soundDefinition.load();
+  m_soundMemory += soundDefinition.getMemory();
+}
+
+void SoundManager::loadAsync(const std::shared_ptr<SoundDefinition> &soundDefinition) {
+  if (soundDefinition->m_isLoaded || soundDefinition->m_loading.valid())
+    return;
+  soundDefinition->loadAsync();
+  m_loadingSounds.push_back(soundDefinition);
+}
+
+void SoundManager::unload(SoundDefinition &soundDefinition) {
+  m_soundMemory -= soundDefinition.getMemory();
+  soundDefinition.unload();
+}
+
 void SoundManager::stopAllSounds() {
   trace("stopAllSounds");
   for (auto channel : m_pEngine->getApplication()->getAudioSystem()) {
     channel.stop();
   }
+  auto &waitManager = Locator<WaitManager>::get();
   for (auto &soundId : m_soundIds) {
+    if (soundId) {
+      waitManager.notify(WaitEvent::Sound, soundId->getId());
+    }
     soundId.reset();
   }
+  for (const auto &pendingSound : m_pendingSounds) {
+    waitManager.notify(WaitEvent::Sound, pendingSound.soundId->getId());
+  }
+  m_pendingSounds.clear();
 }
 
 void SoundManager::stopSound(std::shared_ptr<SoundDefinition> soundDef) {
@@ -92,9 +169,18 @@ void SoundManager::stopSound(std::shared_ptr<SoundDefinition> soundDef) {
     auto sound = m_soundIds[i];
     if (sound && soundDef.get()->getId() == sound->getId()) {
       sound->getSoundHandle()->get().stop();
+      Locator<WaitManager>::get().notify(WaitEvent::Sound, sound->getId());
       m_soundIds[i].reset();
     }
   }
+  m_pendingSounds.erase(std::remove_if(m_pendingSounds.begin(), m_pendingSounds.end(),
+                                       [&soundDef](const auto &pendingSound) {
+                                         if (pendingSound.soundId->getSoundDefinition() != soundDef)
+                                           return false;
+                                         Locator<WaitManager>::get().notify(WaitEvent::Sound,
+                                                                           pendingSound.soundId->getId());
+                                         return true;
+                                       }), m_pendingSounds.end());
 }
 
 void SoundManager::setVolume(const SoundDefinition *pSoundDef, float volume) {
@@ -113,9 +199,133 @@ void SoundManager::update(const ngf::TimeSpan &elapsed) {
     if (soundId) {
       soundId->update(elapsed);
       if (soundId->getSoundHandle()->get().getStatus() == ngf::AudioChannel::Status::Stopped) {
+        auto stoppedSoundId = std::move(soundId);
         soundId.reset();
+        Locator<WaitManager>::get().notify(WaitEvent::Sound, stoppedSoundId->getId());
+        if (stoppedSoundId->getSoundCategory() == SoundCategory::Music) {
+          releaseMusic(stoppedSoundId);
+        }
+      }
+    }
+  }
+  updatePendingSounds();
+  updateLoadingSounds();
+  evictSounds();
+}
+
+void SoundManager::updatePendingSounds() {
+  auto it = m_pendingSounds.begin();
+  while (it != m_pendingSounds.end()) {
+    auto soundId = it->soundId;
+    auto soundDefinition = soundId->getSoundDefinition();
+    // the sound has been stopped before being started
+    if (!soundId->isPlaying()) {
+      Locator<WaitManager>::get().notify(WaitEvent::Sound, soundId->getId());
+      it = m_pendingSounds.erase(it);
+      continue;
+    }
+
+    try {
+      if (!isLoaded(*soundDefinition)) {
+        ++it;
+        continue;
       }
+    } catch (const std::exception &e) {
+      error("Fail to load sound {}: {}", soundDefinition->getPath(), e.what());
+      Locator<WaitManager>::get().notify(WaitEvent::Sound, soundId->getId());
+      it = m_pendingSounds.erase(it);
+      continue;
     }
+
+    auto loopTimes = it->loopTimes;
+    auto sound = m_pEngine->getApplication()->getAudioSystem().playSound(*soundDefinition->m_buffer,
+                                                                         loopTimes,
+                                                                         it->fadeInTime);
+    it = m_pendingSounds.erase(it);
+    auto index = sound->get().getChannel();
+    if (index == -1) {
+      error("cannot play sound no more channel available");
+      Locator<WaitManager>::get().notify(WaitEvent::Sound, soundId->getId());
+      continue;
+    }
+    trace("[{}] loop {} music {}", index, loopTimes, soundDefinition->getPath());
+    soundId->setSoundHandle(sound);
+    m_soundIds[index] = soundId;
+  }
+}
+
+bool SoundManager::isUsed(const std::shared_ptr<SoundDefinition> &soundDefinition) const {
+  auto isPlayed = std::any_of(m_soundIds.cbegin(), m_soundIds.cend(), [&soundDefinition](const auto &soundId) {
+    return soundId && soundId->getSoundDefinition() == soundDefinition;
+  });
+  if (isPlayed)
+    return true;
+  return std::any_of(m_pendingSounds.cbegin(), m_pendingSounds.cend(), [&soundDefinition](const auto &pendingSound) {
+    return pendingSound.soundId->getSoundDefinition() == soundDefinition;
+  });
+}
+
+void SoundManager::updateLoadingSounds() {
+  // the memory of a sound decoded by a worker thread is accounted once its decoding is finished
+  m_loadingSounds.erase(std::remove_if(m_loadingSounds.begin(), m_loadingSounds.end(), [this](const auto &sound) {
+    try {
+      return isLoaded(*sound) || !sound->m_loading.valid();
+    } catch (const std::exception &e) {
+      error("Fail to load sound {}: {}", sound->getPath(), e.what());
+      return true;
+    }
+  }), m_loadingSounds.end());
+}
+
+void SoundManager::evictSounds() {
+  if (m_soundMemory <= m_soundBudget)
+    return;
+
+  // only the sounds not played by any channel can be released
+  std::unordered_set<const SoundDefinition *> usedSounds;
+  usedSounds.insert(m_pSoundHover.get());
+  for (const auto &soundId : m_soundIds) {
+    if (soundId)
+      usedSounds.insert(soundId->getSoundDefinition().get());
+  }
+  for (const auto &pendingSound : m_pendingSounds) {
+    usedSounds.insert(pendingSound.soundId->getSoundDefinition().get());
+  }
+
+  std::vector<SoundDefinition *> sounds;
+  for (const auto &sound : m_sounds) {
+    if (sound->m_isLoaded && usedSounds.find(sound.get()) == usedSounds.end())
+      sounds.push_back(sound.get());
+  }
+  std::sort(sounds.begin(), sounds.end(), [](const auto *pSound1, const auto *pSound2) {
+    return pSound1->m_lastUse < pSound2->m_lastUse;
+  });
+
+  for (auto *pSound : sounds) {
+    if (m_soundMemory <= m_soundBudget)
+      break;
+    trace("Evict sound {}", pSound->getPath());
+    unload(*pSound);
+    m_evictedSounds++;
+  }
+  pruneSounds();
+}
+
+void SoundManager::pruneSounds() {
+  // a transient sound only referenced by the manager cannot be played anymore
+  m_sounds.erase(std::remove_if(m_sounds.begin(), m_sounds.end(), [this](const auto &sound) {
+    if (!sound->m_isTransient || sound.use_count() != 1)
+      return false;
+    unload(*sound);
+    return true;
+  }), m_sounds.end());
+}
+
+void SoundManager::releaseMusic(const std::shared_ptr<SoundId> &soundId) {
+  // a music is released once it's not played anymore, so only the playing musics are kept in memory
+  auto soundDefinition = soundId->getSoundDefinition();
+  if (!isUsed(soundDefinition)) {
+    unload(*soundDefinition);
   }
 }
 
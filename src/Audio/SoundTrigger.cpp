@@ -18,6 +18,10 @@ SoundTrigger::SoundTrigger(Engine &engine, const std::vector<std::shared_ptr<Sou
   for (size_t i = 0; i < sounds.size(); i++) {
     m_sounds[i] = 0;
   }
+  // the sounds are played by the animations, they have to be ready before
+  for (const auto &sound : sounds) {
+    m_engine.getSoundManager().preload(sound);
+  }
 }
 
 SoundTrigger::~SoundTrigger() = default;
@@ -5,8 +5,10 @@
 #include <engge/Engine/Engine.hpp>
 #include <engge/Engine/Preferences.hpp>
 #include <engge/Scripting/ScriptEngine.hpp>
+#include <engge/Graphics/GGFont.hpp>
 #include <engge/Graphics/Screen.hpp>
 #include <engge/Graphics/Text.hpp>
+#include <engge/Graphics/TextCache.hpp>
 
 namespace ng {
 namespace {
@@ -47,9 +49,8 @@ void DialogManager::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
   const auto view = target.getView();
   target.setView(ngf::View(ngf::frect::fromPositionSize({0, 0}, {Screen::Width, Screen::Height})));
 
-  auto retroFonts = m_pEngine->getPreferences().getUserPreference(PreferenceNames::RetroFonts,
-                                                                  PreferenceDefaultValues::RetroFonts);
-  const GGFont &font = m_pEngine->getResourceManager().getFont(retroFonts ? "FontRetroSheet" : "FontModernSheet");
+  const auto &font = m_pEngine->getDefaultFont();
+  auto &textCache = m_pEngine->getTextCache();
 
   auto y = DialogTop;
 
@@ -57,8 +58,6 @@ void DialogManager::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
   auto dialogHighlight = m_pEngine->getVerbUiColors(actorName)->dialogHighlight;
   auto dialogNormal = m_pEngine->getVerbUiColors(actorName)->dialogNormal;
 
-  ng::Text text;
-  text.setFont(font);
   auto hoverDone = false;
   for (const auto &slot : m_slots) {
     if (!slot.pChoice)
@@ -67,15 +66,16 @@ void DialogManager::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
     std::wstring s;
     s = Bullet;
     s += slot.text;
-    text.setWideString(s);
-    text.getTransform().setPosition({slot.pos.x, y + slot.pos.y});
-    auto bounds = getGlobalBounds(text);
+    auto &normalText = textCache.get(s, font, dialogNormal);
+    normalText.getTransform().setPosition({slot.pos.x, y + slot.pos.y});
+    auto bounds = getGlobalBounds(normalText);
     auto hover = bounds.contains(m_mousePos);
-    text.setColor(hover && !hoverDone ? dialogHighlight : dialogNormal);
+    auto &text = hover && !hoverDone ? textCache.get(s, font, dialogHighlight) : normalText;
+    text.getTransform().setPosition({slot.pos.x, y + slot.pos.y});
     hoverDone |= hover;
     text.draw(target, {});
 
-    y += (2.f * getGlobalBounds(text).getHeight() / 3.f);
+    y += (2.f * bounds.getHeight() / 3.f);
   }
 
   target.setView(view);
@@ -120,9 +120,9 @@ void DialogManager::updateChoices(const ngf::TimeSpan &elapsed) {
   if (m_state != DialogManagerState::WaitingForChoice)
     return;
 
-  auto retroFonts = m_pEngine->getPreferences().getUserPreference(PreferenceNames::RetroFonts,
-                                                                  PreferenceDefaultValues::RetroFonts);
-  const GGFont &font = m_pEngine->getResourceManager().getFont(retroFonts ? "FontRetroSheet" : "FontModernSheet");
+  const auto &font = m_pEngine->getDefaultFont();
+  auto &textCache = m_pEngine->getTextCache();
+  auto dialogNormal = m_pEngine->getVerbUiColors(m_pPlayer->getActor())->dialogNormal;
 
   auto y = DialogTop;
   int dialog = 0;
@@ -134,10 +134,8 @@ void DialogManager::updateChoices(const ngf::TimeSpan &elapsed) {
     std::wstring s;
     s = Bullet;
     s += dlg.text;
-    ng::Text text;
-    text.setFont(font);
+    auto &text = textCache.get(s, font, dialogNormal);
     text.getTransform().setPosition({dlg.pos.x, dlg.pos.y + y});
-    text.setWideString(s);
     auto bounds = getGlobalBounds(text);
     if (bounds.getWidth() > Screen::Width) {
       if (bounds.contains(m_mousePos)) {
@@ -174,10 +172,8 @@ void DialogManager::updateChoices(const ngf::TimeSpan &elapsed) {
     std::wstring s;
     s = Bullet;
     s += slot.text;
-    ng::Text text;
-    text.setFont(font);
+    auto &text = textCache.get(s, font, dialogNormal);
     text.getTransform().setPosition({slot.pos.x, slot.pos.y + y});
-    text.setWideString(s);
     if (getGlobalBounds(text).contains(m_mousePos)) {
       choose(dialog + 1);
       break;
@@ -1,8 +1,11 @@
+#include <string_view>
 #include "engge/EnggeApplication.hpp"
 #include "engge/Input/InputMappings.hpp"
 #include "Engine/DebugFeatures.hpp"
 #include <ngf/Graphics/Colors.h>
 #include "engge/Engine/EngineCommands.hpp"
+#include "engge/Graphics/SpriteSheet.hpp"
+#include "engge/Graphics/UIResourceNames.hpp"
 
 namespace {
 ng::InputConstants toKey(ngf::Scancode key) {
@@ -50,12 +53,39 @@ ng::MetaKeys toMetaKeys(const ngf::KeyModifiers &modifiers) {
                                                                                 : ng::MetaKeys::None);
   return metaKey;
 }
+
+struct UISpriteSheet {
+  std::string name;
+  std::shared_ptr<ng::SpriteSheet> spriteSheet;
+  ng::ResourceManager::DecodedImage image;
+};
+
+struct UIFontPage {
+  std::string name;
+  ng::ResourceManager::DecodedImage image;
+};
+
+// gets the images of the pages of a font in the BMFont text format
+std::vector<std::string> getFontPages(const std::vector<char> &buffer) {
+  std::vector<std::string> pages;
+  std::string_view text(buffer.data(), buffer.size());
+  const std::string_view token{"file=\""};
+  for (auto pos = text.find(token); pos != std::string_view::npos; pos = text.find(token, pos)) {
+    pos += token.size();
+    auto end = text.find('"', pos);
+    if (end == std::string_view::npos)
+      break;
+    pages.emplace_back(text.substr(pos, end - pos));
+  }
+  return pages;
+}
 }
 
 namespace ng {
 void EnggeApplication::onInit() {
+  m_startup = std::make_unique<StartupPipeline>();
   m_window.init({"Engge", {ng::Screen::Width, ng::Screen::Height}});
-  ng::Services::init();
+  m_startup->runOnMainThread("services", [] { ng::Services::init(); });
 
   // read achievements if any
   auto achievementsPath = ng::Locator<ng::EngineSettings>::get().getPath();
@@ -71,8 +101,64 @@ void EnggeApplication::onInit() {
     throw std::logic_error(s);
   }
 
+  // load the texts and decode the UI resources while the script engine is initialized
+  auto lang = Locator<Preferences>::get().getUserPreference<std::string>(PreferenceNames::Language,
+                                                                         PreferenceDefaultValues::Language);
+  m_startup->run("text database", [lang] {
+    Locator<TextDatabase>::get().load("ThimbleweedText_" + lang + ".tsv");
+  });
+
+  auto &resourceManager = Locator<ResourceManager>::get();
+  auto pSpriteSheets = std::make_shared<std::vector<UISpriteSheet>>();
+  m_startup->run("UI sprite sheets", [pSpriteSheets, &resourceManager] {
+    for (const auto &name : UIResourceNames::SpriteSheets) {
+      if (!Locator<EngineSettings>::get().hasEntry(name + ".json"))
+        continue;
+      auto spriteSheet = std::make_shared<SpriteSheet>();
+      spriteSheet->setTextureManager(&resourceManager);
+      spriteSheet->load(name);
+      auto image = ResourceManager::decodeImage(spriteSheet->getTextureName());
+      pSpriteSheets->push_back({name, std::move(spriteSheet), std::move(image)});
+    }
+  });
+
+  auto pFontPages = std::make_shared<std::vector<UIFontPage>>();
+  m_startup->run("UI fonts", [pFontPages] {
+    auto &settings = Locator<EngineSettings>::get();
+    for (const auto &name : UIResourceNames::Fonts) {
+      if (!settings.hasEntry(name))
+        continue;
+      auto buffer = settings.readBuffer(name);
+      // a page which fails here is loaded again when the font is used, like before the startup pipeline
+      for (const auto &page : getFontPages(buffer)) {
+        if (!settings.hasEntry(page))
+          continue;
+        try {
+          pFontPages->push_back({page, ResourceManager::decodeImage(page)});
+        } catch (const std::exception &e) {
+          warn("Fail to decode font page {}: {}", page, e.what());
+        }
+      }
+    }
+  });
+
   auto &scriptEngine = ng::Locator<ng::ScriptEngine>::create();
-  m_engine = &ng::Locator<ng::Engine>::create();
+
+  // the textures have to be created by the main thread
+  m_startup->runOnMainThread("UI resources", [this, pSpriteSheets, pFontPages, &resourceManager] {
+    m_startup->wait("UI sprite sheets");
+    for (auto &uiSpriteSheet : *pSpriteSheets) {
+      resourceManager.addDecodedTexture(uiSpriteSheet.spriteSheet->getTextureName(), uiSpriteSheet.image);
+      resourceManager.addSpriteSheet(uiSpriteSheet.name, std::move(uiSpriteSheet.spriteSheet));
+    }
+    m_startup->wait("UI fonts");
+    for (const auto &page : *pFontPages) {
+      resourceManager.addDecodedTexture(page.name, page.image);
+    }
+  });
+  m_startup->wait("text database");
+
+  m_startup->runOnMainThread("engine", [this] { m_engine = &ng::Locator<ng::Engine>::create(); });
   m_engine->setApplication(this);
   scriptEngine.setEngine(*m_engine);
   m_debugTools = std::make_unique<ng::DebugTools>(*m_engine);
@@ -152,6 +238,11 @@ void EnggeApplication::onRender(ngf::RenderTarget &target) {
     m_engine->draw(target);
   Application::onRender(target);
   ng::DebugFeatures::renderTime = clock.getElapsedTime();
+
+  if (m_init && m_startup) {
+    m_startup->logTimings();
+    m_startup.reset();
+  }
 }
 
 void EnggeApplication::onImGuiRender() {
@@ -160,7 +251,7 @@ void EnggeApplication::onImGuiRender() {
 
 void EnggeApplication::onUpdate(const ngf::TimeSpan &elapsed) {
   if (!m_init) {
-    m_engine->run();
+    m_startup->runOnMainThread("boot scripts", [this] { m_engine->run(); });
     m_init = true;
   }
   ngf::StopWatch clock;
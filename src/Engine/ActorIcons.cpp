@@ -7,6 +7,7 @@
 #include "engge/Engine/ActorIcons.hpp"
 #include "engge/Engine/Engine.hpp"
 #include "engge/Room/Room.hpp"
+#include "engge/Graphics/UIResourceNames.hpp"
 
 namespace ng {
 
@@ -179,7 +180,7 @@ void ActorIcons::drawActorIcon(ngf::RenderTarget &target, const std::string &ico
 void ActorIcons::drawActorIcon(ngf::RenderTarget &target, const std::string &icon, ngf::Color backColor,
                                ngf::Color frameColor, const glm::vec2 &offset, float alpha) {
   ngf::RenderStates states;
-  auto &gameSheet = Locator<ResourceManager>::get().getSpriteSheet("GameSheet");
+  auto &gameSheet = Locator<ResourceManager>::get().getSpriteSheet(UIResourceNames::GameSheet);
   const auto &texture = gameSheet.getTexture();
   auto backRect = gameSheet.getRect("icon_background");
   auto backSpriteSourceSize = gameSheet.getSpriteSourceSize("icon_background");
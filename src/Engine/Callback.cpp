@@ -15,7 +15,7 @@
 
 namespace ng {
 Callback::Callback(int id, ngf::TimeSpan duration, std::string method, HSQOBJECT arg)
-    : TimeFunction(duration), m_id(id), m_method(std::move(method)), m_arg(arg) {
+    : m_id(id), m_duration(duration), m_method(std::move(method)), m_arg(arg) {
   sq_addref(ScriptEngine::getVm(), &m_arg);
 }
 
@@ -23,11 +23,7 @@ Callback::~Callback(){
   sq_release(ScriptEngine::getVm(), &m_arg);
 }
 
-void Callback::onElapsed() {
-  if (m_callbackDone)
-    return;
-  m_callbackDone = true;
-
+void Callback::call() {
   auto v = ScriptEngine::getVm();
   SQObjectPtr method;
   _table(v->_roottable)->Get(ScriptEngine::toSquirrel(m_method), method);
@@ -1,6 +1,8 @@
 #include <algorithm>
 #include "engge/Engine/Camera.hpp"
 #include "engge/Engine/Engine.hpp"
+#include "engge/Engine/WaitManager.hpp"
+#include "engge/System/Locator.hpp"
 #include "engge/Room/Room.hpp"
 
 namespace ng {
@@ -53,6 +55,7 @@ void Camera::at(const glm::vec2 &at) {
   m_pImpl->_target = m_pImpl->_at;
   m_pImpl->_time = ngf::TimeSpan::seconds(0);
   m_pImpl->_isMoving = false;
+  Locator<WaitManager>::get().notify(WaitEvent::Camera, 0);
 }
 
 ngf::frect Camera::getRect() const {
@@ -68,6 +71,7 @@ void Camera::move(const glm::vec2 &offset) {
   m_pImpl->clampCamera(m_pImpl->_at);
   m_pImpl->_target = m_pImpl->_at;
   m_pImpl->_isMoving = false;
+  Locator<WaitManager>::get().notify(WaitEvent::Camera, 0);
 }
 
 void Camera::setBounds(const ngf::irect &cameraBounds) {
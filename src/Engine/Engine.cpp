@@ -53,14 +53,7 @@ Engine::Engine() : m_pImpl(std::make_unique<Impl>()) {
   m_pImpl->m_camera.setEngine(this);
   m_pImpl->m_talkingState.setEngine(this);
 
-  // load all messages
-  std::stringstream s;
-  auto lang =
-      m_pImpl->m_preferences.getUserPreference<std::string>(PreferenceNames::Language,
-                                                            PreferenceDefaultValues::Language);
-  s << "ThimbleweedText_" << lang << ".tsv";
-  Locator<TextDatabase>::get().load(s.str());
-
+  // the messages are loaded during the startup, before the engine is created
   m_pImpl->m_optionsDialog.setSaveEnabled(true);
   m_pImpl->m_optionsDialog.setEngine(this);
   m_pImpl->m_optionsDialog.setCallback([this]() {
@@ -77,6 +70,8 @@ Engine::Engine() : m_pImpl(std::make_unique<Impl>()) {
     loadGame(slot);
   });
 
+  m_pImpl->updateTextureBudget();
+  m_pImpl->updateSoundBudget();
   m_pImpl->m_preferences.subscribe([this](const std::string &name) {
     if (name == PreferenceNames::Language) {
       auto newLang = m_pImpl->m_preferences.getUserPreference<std::string>(PreferenceNames::Language,
@@ -86,6 +81,12 @@ Engine::Engine() : m_pImpl(std::make_unique<Impl>()) {
       auto fullscreen = m_pImpl->m_preferences.getUserPreference(PreferenceNames::Fullscreen,
                                                                  PreferenceDefaultValues::Fullscreen);
       m_pImpl->m_pApp->getWindow().setFullscreen(fullscreen);
+    } else if (name == PreferenceNames::RetroFonts) {
+      m_pImpl->m_pDefaultFont = nullptr;
+    } else if (name == PreferenceNames::EnggeTextureMemoryBudget) {
+      m_pImpl->updateTextureBudget();
+    } else if (name == PreferenceNames::EnggeSoundMemoryBudget) {
+      m_pImpl->updateSoundBudget();
     }
   });
 }
@@ -101,6 +102,17 @@ ng::EnggeApplication *Engine::getApplication() { return m_pImpl->m_pApp; }
 
 ResourceManager &Engine::getResourceManager() { return m_pImpl->m_resourceManager; }
 
+TextCache &Engine::getTextCache() { return m_pImpl->m_textCache; }
+
+GGFont &Engine::getDefaultFont() {
+  if (!m_pImpl->m_pDefaultFont) {
+    auto retroFonts = m_pImpl->m_preferences.getUserPreference(PreferenceNames::RetroFonts,
+                                                               PreferenceDefaultValues::RetroFonts);
+    m_pImpl->m_pDefaultFont = &m_pImpl->m_resourceManager.getFont(retroFonts ? "FontRetroSheet" : "FontModernSheet");
+  }
+  return *m_pImpl->m_pDefaultFont;
+}
+
 Room *Engine::getRoom() { return m_pImpl->m_pRoom; }
 
 std::wstring Engine::getText(int id) {
@@ -123,12 +135,14 @@ std::vector<std::unique_ptr<Room>> &Engine::getRooms() { return m_pImpl->m_rooms
 
 void Engine::addFunction(std::unique_ptr<Function> function) { m_pImpl->m_newFunctions.push_back(std::move(function)); }
 
-void Engine::addCallback(std::unique_ptr<Callback> callback) { m_pImpl->m_callbacks.push_back(std::move(callback)); }
+TimerQueue &Engine::getTimers() { return m_pImpl->m_timers; }
+
+void Engine::addCallback(std::unique_ptr<Callback> callback) { m_pImpl->addCallback(std::move(callback)); }
 
 void Engine::removeCallback(int id) {
-  auto it = std::find_if(m_pImpl->m_callbacks.begin(), m_pImpl->m_callbacks.end(),
-                         [id](auto &callback) -> bool { return callback->getId() == id; });
+  auto it = m_pImpl->m_callbacks.find(id);
   if (it != m_pImpl->m_callbacks.end()) {
+    m_pImpl->m_timers.cancel(it->second.timerId);
     m_pImpl->m_callbacks.erase(it);
   }
 }
@@ -230,6 +244,8 @@ void Engine::setScriptExecute(std::unique_ptr<ScriptExecute> scriptExecute) {
   m_pImpl->m_pScriptExecute = std::move(scriptExecute);
 }
 
+const ScriptExecute *Engine::getScriptExecute() const { return m_pImpl->m_pScriptExecute.get(); }
+
 void Engine::addThread(std::unique_ptr<ThreadBase> thread) { m_pImpl->m_threads.push_back(std::move(thread)); }
 
 std::vector<std::unique_ptr<ThreadBase>> &Engine::getThreads() { return m_pImpl->m_threads; }
@@ -324,6 +340,7 @@ void Engine::update(const ngf::TimeSpan &el) {
                                          PreferenceDefaultValues::EnggeGameSpeedFactor);
   const ngf::TimeSpan elapsed(ngf::TimeSpan::seconds(el.getTotalSeconds() * gameSpeedFactor));
   m_pImpl->stopThreads();
+  m_pImpl->m_resourceManager.update();
   auto screenSize = m_pImpl->m_pRoom->getScreenSize();
   auto view = ngf::View{ngf::frect::fromPositionSize({0, 0}, screenSize)};
   m_pImpl->m_mousePos = m_pImpl->m_pApp->getRenderTarget()->mapPixelToCoords(ngf::Mouse::getPosition(), view);
@@ -511,46 +528,44 @@ void Engine::draw(ngf::RenderTarget &target, bool screenshot) const {
   if (!m_pImpl->m_pRoom)
     return;
 
-  // update room shader if necessary
+  // forget the texts not displayed since the last frame
+  m_pImpl->m_textCache.purge();
+
+  // select the room shader
   ngf::RenderStates states;
   auto effect = m_pImpl->m_pRoom->getEffect();
-  if (m_pImpl->m_roomEffect != effect) {
-    if (effect == RoomEffectConstants::EFFECT_BLACKANDWHITE) {
-      m_pImpl->m_roomShader.load(Shaders::vertexShader, Shaders::bwFragmentShader);
-    } else if (effect == RoomEffectConstants::EFFECT_EGA) {
-      m_pImpl->m_roomShader.load(Shaders::vertexShader, Shaders::egaFragmenShader);
-    } else if (effect == RoomEffectConstants::EFFECT_GHOST) {
-      m_pImpl->m_roomShader.load(Shaders::vertexShader, Shaders::ghostFragmentShader);
-    } else if (effect == RoomEffectConstants::EFFECT_SEPIA) {
-      m_pImpl->m_roomShader.load(Shaders::vertexShader, Shaders::sepiaFragmentShader);
-    } else if (effect == RoomEffectConstants::EFFECT_VHS) {
-      m_pImpl->m_roomShader.load(Shaders::vertexShader, Shaders::vhsFragmentShader);
-    }
-    m_pImpl->m_roomEffect = effect;
+  if (effect < RoomEffectConstants::EFFECT_NONE || effect > RoomEffectConstants::EFFECT_BLACKANDWHITE) {
+    effect = RoomEffectConstants::EFFECT_NONE;
   }
-  states.shader = &m_pImpl->m_roomShader;
+  auto &roomShader = m_pImpl->m_roomShaders[effect];
+  states.shader = &roomShader;
   if (effect == RoomEffectConstants::EFFECT_GHOST) {
     // don't remove the fmod function or you will have float overflow with the shader and the effect will look strange
-    m_pImpl->m_roomShader.setUniform("iGlobalTime", roomEffect.iGlobalTime);
-    m_pImpl->m_roomShader.setUniform("iFade", roomEffect.iFade);
-    m_pImpl->m_roomShader.setUniform("wobbleIntensity", roomEffect.wobbleIntensity);
-    m_pImpl->m_roomShader.setUniform("shadows", roomEffect.shadows);
-    m_pImpl->m_roomShader.setUniform("midtones", roomEffect.midtones);
-    m_pImpl->m_roomShader.setUniform("highlights", roomEffect.highlights);
+    roomShader.setUniform("iGlobalTime", roomEffect.iGlobalTime);
+    roomShader.setUniform("iFade", roomEffect.iFade);
+    roomShader.setUniform("wobbleIntensity", roomEffect.wobbleIntensity);
+    roomShader.setUniform("shadows", roomEffect.shadows);
+    roomShader.setUniform("midtones", roomEffect.midtones);
+    roomShader.setUniform("highlights", roomEffect.highlights);
   } else if (effect == RoomEffectConstants::EFFECT_SEPIA) {
-    m_pImpl->m_roomShader.setUniform("sepiaFlicker", roomEffect.sepiaFlicker);
-    m_pImpl->m_roomShader.setUniformArray("RandomValue", roomEffect.RandomValue.data(), 5);
-    m_pImpl->m_roomShader.setUniform("TimeLapse", roomEffect.TimeLapse);
+    roomShader.setUniform("sepiaFlicker", roomEffect.sepiaFlicker);
+    roomShader.setUniformArray("RandomValue", roomEffect.RandomValue.data(), 5);
+    roomShader.setUniform("TimeLapse", roomEffect.TimeLapse);
   } else if (effect == RoomEffectConstants::EFFECT_VHS) {
-    m_pImpl->m_roomShader.setUniform("iGlobalTime", roomEffect.iGlobalTime);
-    m_pImpl->m_roomShader.setUniform("iNoiseThreshold", roomEffect.iNoiseThreshold);
+    roomShader.setUniform("iGlobalTime", roomEffect.iGlobalTime);
+    roomShader.setUniform("iNoiseThreshold", roomEffect.iNoiseThreshold);
   } else if (effect == RoomEffectConstants::EFFECT_NONE) {
     states.shader = nullptr;
   }
 
-  // render the room to a texture, this allows to create a post process effect: room effect
-  ngf::RenderTexture roomTexture(target.getSize());
+  // the room and its effects can be rendered at the room resolution and upscaled once to the target
+  auto nativeResolution = m_pImpl->m_preferences.getUserPreference(PreferenceNames::EnggeNativeRoomResolution,
+                                                                   PreferenceDefaultValues::EnggeNativeRoomResolution);
   auto screenSize = m_pImpl->m_pRoom->getScreenSize();
+  auto roomTargetSize = nativeResolution ? screenSize : target.getSize();
+
+  // render the room to a texture, this allows to create a post process effect: room effect
+  auto &roomTexture = m_pImpl->m_renderTargets.get(RenderTargetId::Room, roomTargetSize);
   ngf::View view(ngf::frect::fromPositionSize({0, 0}, screenSize));
   roomTexture.setView(view);
   roomTexture.clear();
@@ -558,7 +573,7 @@ void Engine::draw(ngf::RenderTarget &target, bool screenshot) const {
   roomTexture.display();
 
   // then render a sprite with this texture and apply the room effect
-  ngf::RenderTexture roomWithEffectTexture(target.getSize());
+  auto &roomWithEffectTexture = m_pImpl->m_renderTargets.get(RenderTargetId::RoomWithEffect, roomTargetSize);
   roomWithEffectTexture.clear();
   ngf::Sprite sprite(roomTexture.getTexture());
   sprite.draw(roomWithEffectTexture, states);
@@ -576,28 +591,35 @@ void Engine::draw(ngf::RenderTarget &target, bool screenshot) const {
                std::clamp(
                    m_pImpl->m_fadeEffect.elapsed.getTotalSeconds() / m_pImpl->m_fadeEffect.duration.getTotalSeconds(),
                    0.f, 1.f);
-  ngf::RenderTexture roomTexture2(target.getSize());
-  roomTexture2.setView(view);
-  roomTexture2.clear();
-  if (m_pImpl->m_fadeEffect.effect == FadeEffect::Wobble) {
-    m_pImpl->m_fadeEffect.room->draw(roomTexture2, m_pImpl->m_fadeEffect.cameraTopLeft);
-  }
-  roomTexture2.display();
 
-  ngf::RenderTexture roomTexture3(target.getSize());
-  ngf::Sprite sprite2(roomTexture2.getTexture());
-  sprite2.draw(roomTexture3, {});
-  roomTexture3.display();
+  // the fade passes are only needed during a fade or a wobble
+  const ngf::Texture *fadeTexture{nullptr};
+  if (m_pImpl->m_fadeEffect.effect != FadeEffect::None) {
+    auto &roomTexture2 = m_pImpl->m_renderTargets.get(RenderTargetId::FadeRoom, roomTargetSize);
+    roomTexture2.setView(view);
+    roomTexture2.clear();
+    if (m_pImpl->m_fadeEffect.effect == FadeEffect::Wobble) {
+      m_pImpl->m_fadeEffect.room->draw(roomTexture2, m_pImpl->m_fadeEffect.cameraTopLeft);
+    }
+    roomTexture2.display();
+
+    auto &roomTexture3 = m_pImpl->m_renderTargets.get(RenderTargetId::FadeRoomWithEffect, roomTargetSize);
+    roomTexture3.clear();
+    ngf::Sprite sprite2(roomTexture2.getTexture());
+    sprite2.draw(roomTexture3, {});
+    roomTexture3.display();
+    fadeTexture = &roomTexture3.getTexture();
+  }
 
   const ngf::Texture *texture1{nullptr};
   const ngf::Texture *texture2{nullptr};
   switch (m_pImpl->m_fadeEffect.effect) {
   case FadeEffect::Wobble:
-  case FadeEffect::In:texture1 = &roomTexture3.getTexture();
+  case FadeEffect::In:texture1 = fadeTexture;
     texture2 = &roomWithEffectTexture.getTexture();
     break;
   case FadeEffect::Out:texture1 = &roomWithEffectTexture.getTexture();
-    texture2 = &roomTexture3.getTexture();
+    texture2 = fadeTexture;
     break;
   default:texture1 = &roomWithEffectTexture.getTexture();
     texture2 = &roomWithEffectTexture.getTexture();
@@ -614,7 +636,12 @@ void Engine::draw(ngf::RenderTarget &target, bool screenshot) const {
 
   // apply the room rotation
   auto pos = target.getView().getSize() / 2.f;
-  fadeSprite.getTransform().setOrigin(pos);
+  if (nativeResolution) {
+    fadeSprite.getTransform().setOrigin(glm::vec2(roomTargetSize) / 2.f);
+    fadeSprite.getTransform().setScale(target.getView().getSize() / glm::vec2(roomTargetSize));
+  } else {
+    fadeSprite.getTransform().setOrigin(pos);
+  }
   fadeSprite.getTransform().setPosition(pos);
   fadeSprite.getTransform().setRotation(m_pImpl->m_pRoom->getRotation());
   fadeSprite.draw(target, states);
@@ -3,6 +3,7 @@
 #include <engge/Graphics/Text.hpp>
 #include <engge/Graphics/AnimDrawable.hpp>
 #include "../Graphics/PathDrawable.hpp"
+#include <engge/Graphics/UIResourceNames.hpp>
 
 namespace ng {
 ngf::Color toColor(const ObjectType &type) {
@@ -70,6 +71,12 @@ Engine::Impl::Impl()
     m_preferences.setTempPreference(TempPreferenceNames::ShowHotspot, down);
   });
 
+  // compile all the room effect shaders once: changing the room effect just selects one of them
+  m_roomShaders[RoomEffectConstants::EFFECT_SEPIA].load(Shaders::vertexShader, Shaders::sepiaFragmentShader);
+  m_roomShaders[RoomEffectConstants::EFFECT_EGA].load(Shaders::vertexShader, Shaders::egaFragmenShader);
+  m_roomShaders[RoomEffectConstants::EFFECT_VHS].load(Shaders::vertexShader, Shaders::vhsFragmentShader);
+  m_roomShaders[RoomEffectConstants::EFFECT_GHOST].load(Shaders::vertexShader, Shaders::ghostFragmentShader);
+  m_roomShaders[RoomEffectConstants::EFFECT_BLACKANDWHITE].load(Shaders::vertexShader, Shaders::bwFragmentShader);
   m_fadeShader.load(Shaders::vertexShader, Shaders::fadeFragmentShader);
   uint32_t pixels[4]{0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF};
   m_blackTexture.loadFromMemory({2, 2}, pixels);
@@ -281,13 +288,32 @@ void Engine::Impl::setCurrentRoom(Room *pRoom) {
   }
 
   if (pRoom) {
+    pRoom->ensureLoaded();
+    pRoom->pinTextures();
     ScriptEngine::set("currentRoom", pRoom);
   }
   m_camera.resetBounds();
+  m_roomPrefetcher.onRoomChanged(m_pRoom, pRoom);
+  // the textures of the previous room are unpinned, they can be evicted once it's not displayed anymore
+  if (m_pRoom && m_pRoom != pRoom) {
+    m_pRoom->releaseTextures();
+  }
   m_pRoom = pRoom;
   m_camera.at(glm::vec2(0, 0));
 }
 
+void Engine::Impl::updateTextureBudget() {
+  auto budget = m_preferences.getUserPreference(PreferenceNames::EnggeTextureMemoryBudget,
+                                                PreferenceDefaultValues::EnggeTextureMemoryBudget);
+  m_resourceManager.setTextureBudget(static_cast<size_t>(budget) * 1024 * 1024);
+}
+
+void Engine::Impl::updateSoundBudget() {
+  auto budget = m_preferences.getUserPreference(PreferenceNames::EnggeSoundMemoryBudget,
+                                                PreferenceDefaultValues::EnggeSoundMemoryBudget);
+  m_soundManager.setSoundBudget(static_cast<size_t>(budget) * 1024 * 1024);
+}
+
 void Engine::Impl::updateCutscene(const ngf::TimeSpan &elapsed) {
   if (m_pCutscene) {
     (*m_pCutscene)(elapsed);
@@ -307,6 +333,8 @@ void Engine::Impl::updateSentence(const ngf::TimeSpan &elapsed) const {
 }
 
 void Engine::Impl::updateFunctions(const ngf::TimeSpan &elapsed) {
+  Locator<WaitManager>::get().update();
+
   for (auto &function : m_newFunctions) {
     m_functions.push_back(std::move(function));
   }
@@ -318,17 +346,29 @@ void Engine::Impl::updateFunctions(const ngf::TimeSpan &elapsed) {
                                    [](std::unique_ptr<Function> &f) { return f->isElapsed(); }),
                     m_functions.end());
 
-  std::vector<std::unique_ptr<Callback>> callbacks;
-  std::move(m_callbacks.begin(), m_callbacks.end(), std::back_inserter(callbacks));
-  m_callbacks.clear();
-  for (auto &callback : callbacks) {
-    (*callback)(elapsed);
+  // the callbacks and the breaktime are run by the timers, only the due ones are touched
+  m_timers.update(elapsed);
+}
+
+void Engine::Impl::addCallback(std::unique_ptr<Callback> callback) {
+  auto id = callback->getId();
+  auto timerId = m_timers.schedule(callback->getDuration(), [this, id] {
+    auto it = m_callbacks.find(id);
+    if (it == m_callbacks.end())
+      return;
+    // the callback can add or remove other callbacks
+    auto pCallback = std::move(it->second.callback);
+    m_callbacks.erase(it);
+    pCallback->call();
+  });
+  m_callbacks[id] = {std::move(callback), timerId};
+}
+
+void Engine::Impl::clearCallbacks() {
+  for (const auto &callback : m_callbacks) {
+    m_timers.cancel(callback.second.timerId);
   }
-  callbacks.erase(std::remove_if(callbacks.begin(),
-                                 callbacks.end(),
-                                 [](auto &f) { return f->isElapsed(); }),
-                  callbacks.end());
-  std::move(callbacks.begin(), callbacks.end(), std::back_inserter(m_callbacks));
+  m_callbacks.clear();
 }
 
 void Engine::Impl::updateActorIcons(const ngf::TimeSpan &elapsed) {
@@ -713,7 +753,7 @@ void Engine::Impl::drawObjectHotspot(const Object &object, ngf::RenderTarget &ta
   const auto &view = target.getView();
   target.setView(ngf::View{ngf::frect::fromPositionSize({0, 0}, {Screen::Width, Screen::Height})});
 
-  auto &gameSheet = Locator<ResourceManager>::get().getSpriteSheet("GameSheet");
+  auto &gameSheet = Locator<ResourceManager>::get().getSpriteSheet(UIResourceNames::GameSheet);
   ngf::Sprite sprite(*gameSheet.getTexture(), gameSheet.getRect("hotspot_marker"));
   sprite.setColor(ngf::Color(255, 165, 0));
   sprite.getTransform().setOrigin({15.f, 15.f});
@@ -910,7 +950,7 @@ void Engine::Impl::drawPause(ngf::RenderTarget &target) const {
   auto viewRect = ngf::frect::fromPositionSize({0, 0}, {320, 176});
   target.setView(ngf::View(viewRect));
 
-  auto &saveLoadSheet = Locator<ResourceManager>::get().getSpriteSheet("SaveLoadSheet");
+  auto &saveLoadSheet = Locator<ResourceManager>::get().getSpriteSheet(UIResourceNames::SaveLoadSheet);
   auto viewCenter = glm::vec2(viewRect.getWidth() / 2, viewRect.getHeight() / 2);
   auto rect = saveLoadSheet.getRect("pause_dialog");
 
@@ -925,18 +965,12 @@ void Engine::Impl::drawPause(ngf::RenderTarget &target) const {
   viewCenter = glm::vec2(viewRect.getWidth() / 2, viewRect.getHeight() / 2);
   target.setView(ngf::View(viewRect));
 
-  auto retroFonts =
-      m_pEngine->getPreferences().getUserPreference(PreferenceNames::RetroFonts, PreferenceDefaultValues::RetroFonts);
-  auto &font = m_pEngine->getResourceManager().getFont(retroFonts ? "FontRetroSheet" : "FontModernSheet");
-
-  ng::Text text;
+  const auto &font = m_pEngine->getDefaultFont();
+  auto &text = m_textCache.get(Engine::getText(99951), font, ngf::Colors::White);
   auto screen = target.getView().getSize();
   auto scale = screen.y / 512.f;
   text.getTransform().setScale({scale, scale});
   text.getTransform().setPosition(viewCenter);
-  text.setFont(font);
-  text.setColor(ngf::Colors::White);
-  text.setWideString(Engine::getText(99951));
   auto bounds = getGlobalBounds(text);
   text.getTransform().move({-bounds.getWidth() / 2.f, -scale * bounds.getHeight() / 2.f});
   text.draw(target, {});
@@ -945,8 +979,15 @@ void Engine::Impl::drawPause(ngf::RenderTarget &target) const {
 }
 
 void Engine::Impl::stopThreads() {
-  m_threads.erase(std::remove_if(m_threads.begin(), m_threads.end(), [](const auto &t) -> bool {
-    return !t || t->isStopped();
+  auto &waitManager = Locator<WaitManager>::get();
+  m_threads.erase(std::remove_if(m_threads.begin(), m_threads.end(), [&waitManager](const auto &t) -> bool {
+    if (!t)
+      return true;
+    if (!t->isStopped())
+      return false;
+    waitManager.cancel(t->getId());
+    waitManager.notify(WaitEvent::Thread, t->getId());
+    return true;
   }), m_threads.end());
 }
 
@@ -957,7 +998,7 @@ void Engine::Impl::drawCursor(ngf::RenderTarget &target) const {
     return;
 
   auto cursorSize = glm::vec2(68.f, 68.f);
-  const auto &gameSheet = Locator<ResourceManager>::get().getSpriteSheet("GameSheet");
+  const auto &gameSheet = Locator<ResourceManager>::get().getSpriteSheet(UIResourceNames::GameSheet);
 
   const auto view = target.getView();
   target.setView(ngf::View(ngf::frect::fromPositionSize({0, 0}, {Screen::Width, Screen::Height})));
@@ -977,7 +1018,7 @@ void Engine::Impl::drawCursor(ngf::RenderTarget &target) const {
 }
 
 ngf::irect Engine::Impl::getCursorRect() const {
-  auto &gameSheet = Locator<ResourceManager>::get().getSpriteSheet("GameSheet");
+  auto &gameSheet = Locator<ResourceManager>::get().getSpriteSheet(UIResourceNames::GameSheet);
   if (m_state == EngineState::Paused)
     return gameSheet.getRect("cursor_pause");
 
@@ -1061,9 +1102,7 @@ void Engine::Impl::drawCursorText(ngf::RenderTarget &target) const {
   const auto view = target.getView();
   target.setView(ngf::View(ngf::frect::fromPositionSize({0, 0}, {Screen::Width, Screen::Height})));
 
-  auto retroFonts =
-      m_pEngine->getPreferences().getUserPreference(PreferenceNames::RetroFonts, PreferenceDefaultValues::RetroFonts);
-  auto &font = m_pEngine->getResourceManager().getFont(retroFonts ? "FontRetroSheet" : "FontModernSheet");
+  const auto &font = m_pEngine->getDefaultFont();
 
   std::wstring s;
   // draw verb
@@ -1091,19 +1130,14 @@ void Engine::Impl::drawCursorText(ngf::RenderTarget &target) const {
     s.append(L" ").append(getDisplayName(ng::Engine::getText(m_pObj2->getName())));
   }
 
-  ng::Text text;
-  text.setFont(font);
-  text.setColor(textColor);
-  text.setWideString(s);
-
   // do display cursor position:
   if (DebugFeatures::showCursorPosition) {
     std::wstringstream ss;
-    std::wstring txt = text.getWideString();
-    ss << txt << L" (" << std::fixed << std::setprecision(0) << m_mousePosInRoom.x << L"," << m_mousePosInRoom.y
+    ss << s << L" (" << std::fixed << std::setprecision(0) << m_mousePosInRoom.x << L"," << m_mousePosInRoom.y
        << L")";
-    text.setWideString(ss.str());
+    s = ss.str();
   }
+  auto &text = m_textCache.get(s, font, textColor);
 
   // gets the position where to draw the cursor text
   auto bounds = getGlobalBounds(text);
@@ -1127,7 +1161,7 @@ void Engine::Impl::drawNoOverride(ngf::RenderTarget &target) const {
   if (m_noOverrideElapsed > ngf::TimeSpan::seconds(2))
     return;
 
-  auto &gameSheet = Locator<ResourceManager>::get().getSpriteSheet("GameSheet");
+  auto &gameSheet = Locator<ResourceManager>::get().getSpriteSheet(UIResourceNames::GameSheet);
   const auto view = target.getView();
   target.setView(ngf::View(ngf::frect::fromPositionSize({0, 0}, {Screen::Width, Screen::Height})));
 
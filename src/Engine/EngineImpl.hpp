@@ -9,6 +9,7 @@
 #include <engge/Input/InputConstants.hpp>
 #include <engge/Dialog/DialogManager.hpp>
 #include <engge/Graphics/GGFont.hpp>
+#include <engge/Graphics/TextCache.hpp>
 #include <engge/Engine/Inventory.hpp>
 #include <engge/UI/OptionsDialog.hpp>
 #include <engge/UI/StartScreenDialog.hpp>
@@ -24,7 +25,9 @@
 #include <engge/Graphics/SpriteSheet.hpp>
 #include <engge/Engine/TextDatabase.hpp>
 #include <engge/Engine/Thread.hpp>
+#include <engge/Engine/TimerQueue.hpp>
 #include <engge/Engine/Verb.hpp>
+#include <engge/Engine/WaitManager.hpp>
 #include <engge/Scripting/VerbExecute.hpp>
 #include <squirrel.h>
 #include "../../extlibs/squirrel/squirrel/sqpcheader.h"
@@ -47,6 +50,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <ngf/Graphics/Sprite.h>
 #include <ngf/Graphics/RenderTexture.h>
@@ -62,6 +66,8 @@
 #include "Entities/TalkingState.hpp"
 #include "Graphics/WalkboxDrawable.hpp"
 #include "Graphics/GraphDrawable.hpp"
+#include "Graphics/RenderTargetPool.hpp"
+#include "RoomPrefetcher.hpp"
 #include "Shaders.hpp"
 namespace fs = std::filesystem;
 
@@ -302,14 +308,14 @@ struct Engine::Impl {
     }
 
     void loadCallbacks(const ngf::GGPackValue &hash) {
-      m_pImpl->m_callbacks.clear();
+      m_pImpl->clearCallbacks();
       for (auto &callBackHash : hash["callbacks"]) {
         auto name = callBackHash["function"].getString();
         auto id = callBackHash["guid"].getInt();
         auto time = ngf::TimeSpan::seconds(static_cast<float>(callBackHash["time"].getInt()) / 1000.f);
         auto arg = toSquirrel(callBackHash["param"]);
         auto callback = std::make_unique<Callback>(id, time, name, arg);
-        m_pImpl->m_callbacks.push_back(std::move(callback));
+        m_pImpl->addCallback(std::move(callback));
       }
       Locator<EntityManager>::get().setCallbackId(hash["nextGuid"].getInt());
     }
@@ -553,6 +559,9 @@ struct Engine::Impl {
 
       ScriptEngine::call("preLoad");
 
+      // the threads waiting for an event are not saved
+      Locator<WaitManager>::get().clear();
+
       loadGameScene(hash["gameScene"]);
       loadDialog(hash["dialog"]);
       loadCallbacks(hash["callbacks"]);
@@ -825,11 +834,13 @@ struct Engine::Impl {
 
     [[nodiscard]] ngf::GGPackValue saveCallbacks() const {
       ngf::GGPackValue callbacksArray;
-      for (auto &callback : m_pImpl->m_callbacks) {
+      for (const auto &scheduledCallback : m_pImpl->m_callbacks) {
+        const auto &callback = scheduledCallback.second.callback;
+        auto elapsed = callback->getDuration() - m_pImpl->m_timers.getRemainingTime(scheduledCallback.second.timerId);
         ngf::GGPackValue callbackHash{
             {"function", callback->getMethod()},
             {"guid", callback->getId()},
-            {"time", callback->getElapsed().getTotalMilliseconds()}
+            {"time", elapsed.getTotalMilliseconds()}
         };
         auto arg = callback->getArgument();
         if (arg._type != OT_NULL) {
@@ -874,18 +885,27 @@ struct Engine::Impl {
     Impl *m_pImpl{nullptr};
   };
 
+  struct ScheduledCallback {
+    std::unique_ptr<Callback> callback;
+    int timerId{0}; ///< id of the timer calling the callback
+  };
+
   Engine *m_pEngine{nullptr};
   ResourceManager &m_resourceManager;
   Room *m_pRoom{nullptr};
-  int m_roomEffect{0};
-  ngf::Shader m_roomShader;
+  std::array<ngf::Shader, RoomEffectConstants::EFFECT_BLACKANDWHITE + 1> m_roomShaders;
   ngf::Shader m_fadeShader;
   ngf::Texture m_blackTexture;
+  RenderTargetPool m_renderTargets;
+  RoomPrefetcher m_roomPrefetcher;
+  mutable TextCache m_textCache;
+  GGFont *m_pDefaultFont{nullptr};
   std::vector<std::unique_ptr<Actor>> m_actors;
   std::vector<std::unique_ptr<Room>> m_rooms;
   std::vector<std::unique_ptr<Function>> m_newFunctions;
   std::vector<std::unique_ptr<Function>> m_functions;
-  std::vector<std::unique_ptr<Callback>> m_callbacks;
+  TimerQueue m_timers;
+  std::unordered_map<int, ScheduledCallback> m_callbacks; ///< callbacks by id
   Cutscene *m_pCutscene{nullptr};
   ng::EnggeApplication *m_pApp{nullptr};
   Actor *m_pCurrentActor{nullptr};
@@ -949,6 +969,8 @@ struct Engine::Impl {
   bool clickedAt(const glm::vec2 &pos) const;
   void updateCutscene(const ngf::TimeSpan &elapsed);
   void updateFunctions(const ngf::TimeSpan &elapsed);
+  void addCallback(std::unique_ptr<Callback> callback);
+  void clearCallbacks();
   void updateActorIcons(const ngf::TimeSpan &elapsed);
   void updateSentence(const ngf::TimeSpan &elapsed) const;
   void updateMouseCursor();
@@ -957,6 +979,8 @@ struct Engine::Impl {
   SQInteger exitRoom(Object *pObject);
   void updateRoomScalings() const;
   void setCurrentRoom(Room *pRoom);
+  void updateTextureBudget();
+  void updateSoundBudget();
   uint32_t getFlags(int id) const;
   uint32_t getFlags(Entity *pEntity) const;
   Entity *getHoveredEntity(const glm::vec2 &mousPos);
@@ -2,6 +2,7 @@
 #include <filesystem>
 #include "engge/System/Locator.hpp"
 #include "engge/System/Logger.hpp"
+#include "engge/System/ThreadPool.hpp"
 #include "engge/Engine/Preferences.hpp"
 #include "engge/Engine/EngineSettings.hpp"
 #include "../Util/Util.hpp"
@@ -23,62 +24,110 @@ std::filesystem::path EngineSettings::getPath() const {
 }
 
 void EngineSettings::loadPacks() {
+  struct OpenedPack {
+    std::unique_ptr<ngf::GGPack> pack;
+    std::vector<std::string> entries;
+  };
+
+  // the packs are opened and indexed by the workers
+  std::vector<std::pair<fs::path, std::future<OpenedPack>>> packs;
   auto path = getPath();
   for (const auto &entry : fs::directory_iterator(path)) {
     if (ng::startsWith(entry.path().extension().string(), ".ggpack")) {
-      auto pack = std::make_unique<ngf::GGPack>();
-      info("Opening pack '{}'...", entry.path().string());
-      pack->open(entry.path().string());
-      m_packs.push_back(std::move(pack));
+      auto packPath = entry.path();
+      packs.emplace_back(packPath, Locator<ThreadPool>::get().enqueue([packPath] {
+        OpenedPack opened{std::make_unique<ngf::GGPack>(), {}};
+        info("Opening pack '{}'...", packPath.string());
+        opened.pack->open(packPath.string());
+        for (const auto &itEntry : *opened.pack) {
+          opened.entries.push_back(str_toupper(itEntry.first));
+        }
+        return opened;
+      }));
     }
   }
+
+  // index the entries once in the directory order, the first pack containing an entry wins
+  for (auto &[packPath, result] : packs) {
+    auto opened = result.get();
+    for (auto &name : opened.entries) {
+      m_entries.emplace(std::move(name), opened.pack.get());
+    }
+    m_packPaths.emplace(opened.pack.get(), packPath);
+    m_packs.push_back(std::move(opened.pack));
+  }
+  scanOverrides();
 }
 
-bool EngineSettings::hasEntry(const std::string &name) {
-  std::ifstream is;
-  is.open(name);
-  if (is.is_open()) {
-    is.close();
-    return true;
+void EngineSettings::scanOverrides() {
+  m_overrides.clear();
+  for (const auto &entry : fs::directory_iterator(fs::current_path())) {
+    if (!entry.is_regular_file() || ng::startsWith(entry.path().extension().string(), ".ggpack"))
+      continue;
+    m_overrides.emplace(str_toupper(entry.path().filename().string()), entry.path());
   }
-  auto it = std::find_if(m_packs.cbegin(), m_packs.cend(), [&name](const auto &pack) {
-    return pack->contains(name);
-  });
-  return it != m_packs.end();
+}
+
+ngf::GGPack *EngineSettings::findPack(const std::string &name) const {
+  auto it = m_entries.find(str_toupper(name));
+  return it == m_entries.end() ? nullptr : it->second;
+}
+
+const fs::path *EngineSettings::findOverride(const std::string &name) const {
+  auto it = m_overrides.find(str_toupper(name));
+  return it == m_overrides.end() ? nullptr : &it->second;
+}
+
+bool EngineSettings::hasEntry(const std::string &name) {
+  return findOverride(name) || findPack(name);
 }
 
 std::vector<char> EngineSettings::readBuffer(const std::string &name) const {
   // first try to find the resource in the filesystem
-  std::ifstream is;
-  is.open(name);
-  if (is.is_open()) {
-    is.seekg(0, std::ios::end);
-    auto size = is.tellg();
-    std::vector<char> data;
-    data.resize(size);
-    is.seekg(0, std::ios::beg);
-    is.read(data.data(), size);
-    is.close();
-    return data;
+  auto pPath = findOverride(name);
+  if (pPath) {
+    std::ifstream is;
+    is.open(*pPath, std::ios::binary);
+    if (is.is_open()) {
+      is.seekg(0, std::ios::end);
+      auto size = is.tellg();
+      std::vector<char> data;
+      data.resize(size);
+      is.seekg(0, std::ios::beg);
+      is.read(data.data(), size);
+      is.close();
+      return data;
+    }
   }
 
   // not found in filesystem, check in the pack files
-  auto it = std::find_if(m_packs.cbegin(), m_packs.cend(), [&name](const auto &pack) {
-    return pack->contains(name);
-  });
-  if (it != m_packs.end()) {
-    return it->get()->readEntry(name);
+  auto pPack = findPack(name);
+  if (pPack) {
+    std::lock_guard<std::mutex> lock(m_packMutex);
+    return pPack->readEntry(name);
+  }
+  throwEntryNotFound(name);
+  assert(false);
+}
+
+fs::file_time_type EngineSettings::getLastWriteTime(const std::string &name) const {
+  auto pPath = findOverride(name);
+  if (pPath) {
+    return fs::last_write_time(*pPath);
+  }
+  auto pPack = findPack(name);
+  if (pPack) {
+    return fs::last_write_time(m_packPaths.at(pPack));
   }
   throwEntryNotFound(name);
   assert(false);
 }
 
 ngf::GGPackValue EngineSettings::readEntry(const std::string &name) const {
-  auto it = std::find_if(m_packs.cbegin(), m_packs.cend(), [&name](const auto &pack) {
-    return pack->contains(name);
-  });
-  if (it != m_packs.end()) {
-    return it->get()->readHashEntry(name);
+  auto pPack = findPack(name);
+  if (pPack) {
+    std::lock_guard<std::mutex> lock(m_packMutex);
+    return pPack->readHashEntry(name);
   }
   throwEntryNotFound(name);
   assert(false);
@@ -61,11 +61,12 @@ Sound *EntityManager::getSoundFromId(int id) {
       return sound.get();
   }
 
-  for (auto sound : ng::Locator<ng::Engine>::get().getSoundManager().getSounds()) {
+  auto &soundManager = ng::Locator<ng::Engine>::get().getSoundManager();
+  for (auto sound : soundManager.getSounds()) {
     if (sound && sound->getId() == id)
       return sound.get();
   }
-  return nullptr;
+  return soundManager.getPendingSound(id);
 }
 
 ThreadBase *EntityManager::getThreadFromId(int id) {
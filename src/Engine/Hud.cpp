@@ -6,6 +6,7 @@
 #include "engge/Scripting/ScriptEngine.hpp"
 #include "engge/System/Locator.hpp"
 #include "Shaders.hpp"
+#include "engge/Graphics/UIResourceNames.hpp"
 
 namespace ng {
 Hud::Hud() {
@@ -82,7 +83,7 @@ void Hud::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
   const auto &verbUiColors = getVerbUiColors(m_currentActorIndex);
   auto verbHighlight = invertVerbHighlight ? ngf::Colors::White : verbUiColors.verbHighlight;
   auto verbColor = invertVerbHighlight ? verbUiColors.verbHighlight : ngf::Colors::White;
-  auto &gameSheet = Locator<ResourceManager>::get().getSpriteSheet("GameSheet");
+  auto &gameSheet = Locator<ResourceManager>::get().getSpriteSheet(UIResourceNames::GameSheet);
   auto uiBackingRect = hudSentence ? gameSheet.getRect("ui_backing_tall") : gameSheet.getRect("ui_backing");
 
   ngf::Sprite uiBacking(*gameSheet.getTexture(), uiBackingRect);
@@ -97,7 +98,7 @@ void Hud::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
 
   ngf::RenderStates verbStates;
   verbStates.shader = &m_verbShader;
-  auto &verbSheet = Locator<ResourceManager>::get().getSpriteSheet("VerbSheet");
+  auto &verbSheet = Locator<ResourceManager>::get().getSpriteSheet(UIResourceNames::VerbSheet);
   for (int i = 1; i <= 9; i++) {
     auto verb = getVerbSlot(m_currentActorIndex).getVerb(i);
     auto color = verb.id == verbId ? verbHighlight : verbColor;
@@ -130,7 +131,7 @@ void Hud::setCurrentActor(Actor *pActor) {
 glm::vec2 Hud::findScreenPosition(int verbId) const {
   auto pVerb = getVerb(verbId);
   auto s = getVerbName(*pVerb);
-  auto &verbSheet = Locator<ResourceManager>::get().getSpriteSheet("VerbSheet");
+  auto &verbSheet = Locator<ResourceManager>::get().getSpriteSheet(UIResourceNames::VerbSheet);
   auto r = verbSheet.getSpriteSourceSize(s);
   return glm::vec2(r.getTopLeft().x + r.getWidth() / 2.f, Screen::Height - (r.getTopLeft().y + r.getHeight() / 2.f));
 }
@@ -9,12 +9,13 @@
 #include <engge/Room/Room.hpp>
 #include <engge/Graphics/Screen.hpp>
 #include <engge/System/Locator.hpp>
+#include <engge/Graphics/UIResourceNames.hpp>
 
 namespace ng {
 
 void Inventory::setTextureManager(ResourceManager *pTextureManager) {
   m_gameSheet.setTextureManager(pTextureManager);
-  m_gameSheet.load("GameSheet");
+  m_gameSheet.load(UIResourceNames::GameSheet);
 
   m_inventoryItems.setTextureManager(pTextureManager);
   m_inventoryItems.load("InventoryItems");
@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <string>
+#include <squirrel.h>
+#include "engge/Engine/Engine.hpp"
+#include "engge/Entities/Object.hpp"
+#include "engge/Graphics/ResourceManager.hpp"
+#include "engge/Graphics/SpriteSheet.hpp"
+#include "engge/Room/Room.hpp"
+#include "engge/Scripting/ScriptEngine.hpp"
+#include "engge/System/Locator.hpp"
+#include "RoomPrefetcher.hpp"
+#include "../../extlibs/squirrel/squirrel/sqpcheader.h"
+#include "../../extlibs/squirrel/squirrel/sqvm.h"
+#include "../../extlibs/squirrel/squirrel/sqstring.h"
+#include "../../extlibs/squirrel/squirrel/sqfuncproto.h"
+#include "../../extlibs/squirrel/squirrel/sqclosure.h"
+
+namespace ng {
+namespace {
+// gets the strings used by a function and its nested functions, a room is referenced by its name
+void getLiterals(const SQFunctionProto *pFunction, std::vector<std::string> &literals) {
+  for (SQInteger i = 0; i < pFunction->_nliterals; ++i) {
+    const auto &literal = pFunction->_literals[i];
+    if (sq_type(literal) == OT_STRING) {
+      literals.emplace_back(_stringval(literal));
+    }
+  }
+  for (SQInteger i = 0; i < pFunction->_nfunctions; ++i) {
+    getLiterals(_funcproto(pFunction->_functions[i]), literals);
+  }
+}
+}
+
+void RoomPrefetcher::onRoomChanged(Room *pOldRoom, Room *pRoom) {
+  if (!pRoom || pOldRoom == pRoom)
+    return;
+
+  // the rooms adjacent to the previous room may not be adjacent to the new one
+  Locator<ResourceManager>::get().cancelTextureRequests(JobPriority::Low);
+
+  if (pOldRoom) {
+    getAdjacentRooms(*pOldRoom).insert(pRoom);
+    getAdjacentRooms(*pRoom).insert(pOldRoom);
+  }
+
+  for (auto pAdjacentRoom : getAdjacentRooms(*pRoom)) {
+    prefetch(*pAdjacentRoom);
+  }
+}
+
+std::set<Room *> &RoomPrefetcher::getAdjacentRooms(Room &room) {
+  auto it = m_adjacentRooms.find(&room);
+  if (it != m_adjacentRooms.end())
+    return it->second;
+
+  auto &rooms = m_adjacentRooms[&room];
+  findDoorRooms(room, rooms);
+  return rooms;
+}
+
+void RoomPrefetcher::findDoorRooms(Room &room, std::set<Room *> &rooms) {
+  std::vector<std::string> literals;
+  auto v = ScriptEngine::getVm();
+  for (const auto &pObj : room.getObjects()) {
+    if ((pObj->getFlags() & ObjectFlagConstants::DOOR) != ObjectFlagConstants::DOOR)
+      continue;
+
+    sq_pushobject(v, pObj->getTable());
+    sq_pushnull(v);
+    while (SQ_SUCCEEDED(sq_next(v, -2))) {
+      HSQOBJECT value;
+      sq_getstackobj(v, -1, &value);
+      if (sq_type(value) == OT_CLOSURE) {
+        getLiterals(_closure(value)->_function, literals);
+      }
+      sq_pop(v, 2);
+    }
+    sq_pop(v, 2);
+  }
+
+  for (auto &&pRoom : Locator<Engine>::get().getRooms()) {
+    if (pRoom.get() == &room)
+      continue;
+    if (std::find(literals.cbegin(), literals.cend(), pRoom->getName()) != literals.cend()) {
+      rooms.insert(pRoom.get());
+    }
+  }
+}
+
+void RoomPrefetcher::prefetch(Room &room) {
+  room.warmUp();
+
+  auto &resourceManager = Locator<ResourceManager>::get();
+  std::set<std::string> textures;
+  textures.insert(room.getSpriteSheet().getTextureName());
+  for (auto &pObj : room.getObjects()) {
+    for (const auto &anim : pObj->getAnims()) {
+      textures.insert(anim.texture);
+    }
+  }
+
+  for (const auto &texture : textures) {
+    if (texture.empty())
+      continue;
+    resourceManager.requestTexture(texture, JobPriority::Low);
+  }
+}
+} // namespace ng
@@ -0,0 +1,28 @@
+#pragma once
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace ng {
+class Room;
+
+/// @brief Loads in the background the room files and the textures of the rooms the player can go next.
+///
+/// The adjacent rooms are the rooms referenced by the scripts of the doors of a room,
+/// and the rooms the player has already walked between.
+class RoomPrefetcher final {
+public:
+  /// @brief Records the transition between the 2 rooms and prefetches the rooms adjacent to the new room.
+  /// \param pOldRoom Room exited, can be null.
+  /// \param pRoom Room entered, can be null.
+  void onRoomChanged(Room *pOldRoom, Room *pRoom);
+
+private:
+  std::set<Room *> &getAdjacentRooms(Room &room);
+  static void findDoorRooms(Room &room, std::set<Room *> &rooms);
+  static void prefetch(Room &room);
+
+private:
+  std::unordered_map<const Room *, std::set<Room *>> m_adjacentRooms;
+};
+} // namespace ng
@@ -11,7 +11,7 @@ void TextDatabase::load(const std::string &path) {
   m_texts.clear();
   std::wregex re(L"^(\\d+)\\s+(.*)$");
   auto buffer = Locator<EngineSettings>::get().readBuffer(path);
-  GGPackBufferStream input(buffer);
+  GGPackBufferStream input(std::move(buffer));
   std::wstring line;
   while (getLine(input, line)) {
     std::wsmatch matches;
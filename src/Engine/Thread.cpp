@@ -2,6 +2,7 @@
 #include "engge/System/Locator.hpp"
 #include "engge/Engine/EntityManager.hpp"
 #include "engge/Engine/Thread.hpp"
+#include "engge/Scripting/ScriptEngine.hpp"
 #include <utility>
 
 namespace ng {
@@ -13,16 +14,15 @@ Thread::Thread(std::string name, bool isGlobal,
                std::vector<HSQOBJECT> args)
     : m_name(std::move(name)), m_v(v), m_threadObj(thread_obj), m_envObj(env_obj), m_closureObj(closureObj), m_args(std::move(args)),
       m_isGlobal(isGlobal) {
-  sq_addref(m_v, &m_threadObj);
   sq_addref(m_v, &m_envObj);
   sq_addref(m_v, &m_closureObj);
   m_id = Locator<EntityManager>::get().getThreadId();
 }
 
 Thread::~Thread() {
-  sq_release(m_v, &m_threadObj);
   sq_release(m_v, &m_envObj);
   sq_release(m_v, &m_closureObj);
+  ScriptEngine::getThreadVmPool().release(m_v, m_threadObj, hasFailed());
 }
 
 std::string Thread::getName() const {
@@ -42,6 +42,7 @@ bool Thread::call() {
   }
   if (SQ_FAILED(sq_call(thread, 1 + m_args.size(), SQFalse, SQTrue))) {
     sq_settop(thread, top);
+    setFailed();
     return false;
   }
   return true;
@@ -33,7 +33,9 @@ void ThreadBase::suspend() {
 void ThreadBase::resume() {
   if (!isSuspended())
     return;
-  sq_wakeupvm(getThread(), SQFalse, SQFalse, SQTrue, SQFalse);
+  if (SQ_FAILED(sq_wakeupvm(getThread(), SQFalse, SQFalse, SQTrue, SQFalse))) {
+    m_hasFailed = true;
+  }
   m_isSuspended = false;
 }
 
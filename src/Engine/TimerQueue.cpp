@@ -0,0 +1,45 @@
+#include <engge/Engine/TimerQueue.hpp>
+
+namespace ng {
+int TimerQueue::schedule(const ngf::TimeSpan &delay, Action action) {
+  auto id = m_nextId++;
+  auto time = m_time + delay;
+  m_timers[id] = {time, std::move(action)};
+  m_dueTimes.push({time, id});
+  return id;
+}
+
+void TimerQueue::cancel(int id) {
+  m_timers.erase(id);
+}
+
+ngf::TimeSpan TimerQueue::getRemainingTime(int id) const {
+  auto it = m_timers.find(id);
+  if (it == m_timers.end() || it->second.time < m_time)
+    return ngf::TimeSpan::seconds(0);
+  return it->second.time - m_time;
+}
+
+void TimerQueue::clear() {
+  m_timers.clear();
+  m_dueTimes = {};
+}
+
+void TimerQueue::update(const ngf::TimeSpan &elapsed) {
+  m_time += elapsed;
+  // an action is due once its delay is exceeded, so a timer scheduled during the update waits for the next one
+  while (!m_dueTimes.empty() && m_dueTimes.top().time < m_time) {
+    auto id = m_dueTimes.top().id;
+    m_dueTimes.pop();
+
+    // the timer has been cancelled
+    auto it = m_timers.find(id);
+    if (it == m_timers.end())
+      continue;
+
+    auto action = std::move(it->second.action);
+    m_timers.erase(it);
+    action();
+  }
+}
+} // namespace ng
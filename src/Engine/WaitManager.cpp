@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <engge/Engine/EntityManager.hpp>
+#include <engge/Engine/ThreadBase.hpp>
+#include <engge/Engine/WaitManager.hpp>
+
+namespace ng {
+WaitManager::Key WaitManager::getKey(WaitEvent event, int sourceId) {
+  return (static_cast<Key>(event) << 32) | static_cast<uint32_t>(sourceId);
+}
+
+void WaitManager::wait(WaitEvent event, int sourceId, int threadId, Condition condition) {
+  cancel(threadId);
+  auto key = getKey(event, sourceId);
+  m_waits[threadId] = {key, std::move(condition)};
+  m_waiters[key].push_back(threadId);
+  m_notified.push_back(key);
+}
+
+void WaitManager::notify(WaitEvent event, int sourceId) {
+  auto key = getKey(event, sourceId);
+  if (m_waiters.find(key) != m_waiters.end()) {
+    m_notified.push_back(key);
+  }
+  // the threads waiting for any source are notified too
+  auto anyKey = getKey(event, 0);
+  if (sourceId != 0 && m_waiters.find(anyKey) != m_waiters.end()) {
+    m_notified.push_back(anyKey);
+  }
+}
+
+void WaitManager::update() {
+  // the resumed threads can wait or notify again, this is handled at the next update
+  std::vector<Key> notified;
+  std::swap(notified, m_notified);
+  for (auto key : notified) {
+    auto it = m_waiters.find(key);
+    if (it == m_waiters.end())
+      continue;
+
+    auto threadIds = std::move(it->second);
+    m_waiters.erase(it);
+
+    std::vector<int> remainingThreadIds;
+    for (auto threadId : threadIds) {
+      auto waitIt = m_waits.find(threadId);
+      if (waitIt == m_waits.end())
+        continue;
+      auto pThread = EntityManager::getThreadFromId(threadId);
+      if (!pThread) {
+        m_waits.erase(waitIt);
+        continue;
+      }
+      if (!waitIt->second.condition()) {
+        remainingThreadIds.push_back(threadId);
+        continue;
+      }
+      m_waits.erase(waitIt);
+      pThread->resume();
+    }
+
+    if (remainingThreadIds.empty())
+      continue;
+    auto &waiters = m_waiters[key];
+    waiters.insert(waiters.end(), remainingThreadIds.begin(), remainingThreadIds.end());
+  }
+}
+
+void WaitManager::cancel(int threadId) {
+  auto it = m_waits.find(threadId);
+  if (it == m_waits.end())
+    return;
+  removeWaiter(it->second.key, threadId);
+  m_waits.erase(it);
+}
+
+void WaitManager::clear() {
+  m_waits.clear();
+  m_waiters.clear();
+  m_notified.clear();
+}
+
+void WaitManager::removeWaiter(Key key, int threadId) {
+  auto it = m_waiters.find(key);
+  if (it == m_waiters.end())
+    return;
+  auto &threadIds = it->second;
+  threadIds.erase(std::remove(threadIds.begin(), threadIds.end(), threadId), threadIds.end());
+  if (threadIds.empty()) {
+    m_waiters.erase(it);
+  }
+}
+
+size_t WaitManager::getNumWaits() const {
+  return m_waits.size();
+}
+} // namespace ng
@@ -170,6 +170,7 @@ bool Actor::isInventoryObject() const { return false; }
 Actor::Actor(Engine &engine) : m_pImpl(std::make_unique<Impl>(engine)) {
   m_pImpl->setActor(this);
   m_id = Locator<EntityManager>::get().getActorId();
+  m_pImpl->_costume.getAnimControl().setId(m_id);
 }
 
 Actor::~Actor() = default;
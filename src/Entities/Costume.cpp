@@ -242,6 +242,7 @@ void Costume::draw(ngf::RenderTarget &target, ngf::RenderStates states) const {
   AnimDrawable animDrawable;
   animDrawable.setAnim(m_pCurrentAnimation);
   animDrawable.setColor(m_pActor->getColor());
+  animDrawable.setSpriteBatch(&m_pActor->getRoom()->getSpriteBatch());
   if (getFacing() == Facing::FACE_LEFT)
     animDrawable.setFlipX(true);
   animDrawable.draw(m_pActor->getPosition(), target, states);
@@ -37,6 +37,7 @@ struct Entity::Impl {
   ngf::Transform m_transform;
   Entity *m_pParent{nullptr};
   std::vector<Entity *> m_children;
+  bool m_zOrderChanged{true};
 
   Impl() : m_engine(ng::Locator<ng::Engine>::get()) {
     m_talkingState.setEngine(&m_engine);
@@ -86,6 +87,12 @@ void Entity::update(Motor &motor, const ngf::TimeSpan &elapsed) {
   }
 }
 
+bool Entity::hasZOrderChanged() const { return m_pImpl->m_zOrderChanged; }
+
+void Entity::resetZOrderChanged() { m_pImpl->m_zOrderChanged = false; }
+
+void Entity::setZOrderChanged() { m_pImpl->m_zOrderChanged = true; }
+
 void Entity::setLit(bool isLit) {
   m_pImpl->m_isLit = isLit;
 }
@@ -119,6 +126,7 @@ std::optional<UseDirection> Entity::getUseDirection() const {
 void Entity::setPosition(const glm::vec2 &pos) {
   m_pImpl->m_transform.setPosition(pos);
   m_pImpl->m_moveTo.isEnabled = false;
+  setZOrderChanged();
 }
 
 glm::vec2 Entity::getPosition() const {
@@ -291,7 +299,10 @@ void Entity::offsetTo(glm::vec2 destination, ngf::TimeSpan time, InterpolationMe
 
 void Entity::moveTo(glm::vec2 destination, ngf::TimeSpan time, InterpolationMethod method) {
   auto get = [this] { return m_pImpl->m_transform.getPosition(); };
-  auto set = [this](const glm::vec2 &value) { m_pImpl->m_transform.setPosition(value); };
+  auto set = [this](const glm::vec2 &value) {
+    m_pImpl->m_transform.setPosition(value);
+    setZOrderChanged();
+  };
   auto moveTo = std::make_unique<ChangeProperty<glm::vec2>>(get, set, destination, time, method);
   m_pImpl->m_moveTo.function = std::move(moveTo);
   m_pImpl->m_moveTo.isEnabled = true;
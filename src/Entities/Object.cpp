@@ -72,16 +72,21 @@ struct Object::Impl {
 Object::Object() : pImpl(std::make_unique<Impl>()) {
   m_id = Locator<EntityManager>::get().getObjectId();
   ScriptEngine::set(this, "_id", m_id);
+  pImpl->animControl.setId(m_id);
 }
 
 Object::Object(HSQOBJECT obj) : pImpl(std::make_unique<Impl>(obj)) {
   m_id = Locator<EntityManager>::get().getObjectId();
   ScriptEngine::set(this, "_id", m_id);
+  pImpl->animControl.setId(m_id);
 }
 
 Object::~Object() = default;
 
-void Object::setZOrder(int zorder) { pImpl->zorder = zorder; }
+void Object::setZOrder(int zorder) {
+  pImpl->zorder = zorder;
+  setZOrderChanged();
+}
 
 int Object::getZOrder() const { return pImpl->zorder; }
 
@@ -285,6 +290,7 @@ void Object::draw(ngf::RenderTarget &target, ngf::RenderStates states) const {
     AnimDrawable animDrawable;
     animDrawable.setAnim(pImpl->pAnim);
     animDrawable.setColor(getColor());
+    animDrawable.setSpriteBatch(&pImpl->pRoom->getSpriteBatch());
     animDrawable.draw(pos, target, states);
   }
 
@@ -1,5 +1,7 @@
 #include <engge/Engine/EngineSettings.hpp>
+#include <engge/Engine/WaitManager.hpp>
 #include <engge/Graphics/Text.hpp>
+#include <engge/Graphics/TextCache.hpp>
 #include "TalkingState.hpp"
 
 namespace ng {
@@ -27,6 +29,7 @@ void TalkingState::update(const ngf::TimeSpan &elapsed) {
   if (end) {
     if (m_ids.empty()) {
       m_isTalking = false;
+      notifyStopped();
       m_lipAnim.end();
       return;
     }
@@ -40,6 +43,7 @@ void TalkingState::update(const ngf::TimeSpan &elapsed) {
 void TalkingState::stop() {
   m_ids.clear();
   m_isTalking = false;
+  notifyStopped();
   if (m_soundId) {
     auto pSound = dynamic_cast<SoundId *>(EntityManager::getSoundFromId(m_soundId));
     if (pSound) {
@@ -49,6 +53,12 @@ void TalkingState::stop() {
   }
 }
 
+void TalkingState::notifyStopped() {
+  if (!m_pEntity)
+    return;
+  Locator<WaitManager>::get().notify(WaitEvent::Talk, m_pEntity->getId());
+}
+
 bool TalkingState::isTalking() const { return m_isTalking; }
 
 void TalkingState::setTalkColor(ngf::Color color) { m_talkColor = color; }
@@ -87,15 +97,9 @@ void TalkingState::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
   auto view = target.getView();
   target.setView(ngf::View(ngf::frect::fromPositionSize({0, 0}, {Screen::Width, Screen::Height})));
 
-  auto retroFonts = m_pEngine->getPreferences().getUserPreference(PreferenceNames::RetroFonts,
-                                                                  PreferenceDefaultValues::RetroFonts);
-  auto &font = m_pEngine->getResourceManager().getFont(retroFonts ? "FontRetroSheet" : "FontModernSheet");
-
-  ng::Text text;
-  text.setMaxWidth(static_cast<int>((Screen::Width * 3) / 4));
-  text.setFont(font);
-  text.setColor(m_talkColor);
-  text.setWideString(m_sayText);
+  const auto &font = m_pEngine->getDefaultFont();
+  auto &text = m_pEngine->getTextCache().get(m_sayText, font, m_talkColor,
+                                             static_cast<int>((Screen::Width * 3) / 4));
 
   auto bounds = text.getLocalBounds();
   auto pos = m_transform.getPosition();
@@ -132,7 +136,7 @@ void TalkingState::loadActorSpeech(const std::string &name, bool hearVoice) {
   if (!hearVoice)
     return;
 
-  auto soundDefinition = m_pEngine->getSoundManager().defineSound(name + ".ogg");
+  auto soundDefinition = m_pEngine->getSoundManager().defineSound(name + ".ogg", true);
   if (!soundDefinition) {
     error("File {}.ogg not found", name);
     return;
@@ -40,6 +40,7 @@ public:
 private:
   void loadActorSpeech(const std::string &name, bool hearVoice);
   void loadId(int id, const std::string &text, bool mumble);
+  void notifyStopped();
 
 private:
   Engine *m_pEngine{nullptr};
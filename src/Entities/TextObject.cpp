@@ -46,6 +46,11 @@ void TextObject::draw(ngf::RenderTarget &target, ngf::RenderStates states) const
   if (!isVisible())
     return;
 
+  // the pending sprites have to be drawn before this text
+  if (getRoom()) {
+    getRoom()->getSpriteBatch().flush();
+  }
+
   const auto view = target.getView();
   if (getScreenSpace() == ScreenSpace::Object) {
     target.setView(ngf::View(ngf::frect::fromPositionSize({0, 0}, {Screen::Width, Screen::Height})));
@@ -1,7 +1,9 @@
 #include "WalkingState.hpp"
 #include <engge/Entities/Actor.hpp>
 #include <engge/Entities/Costume.hpp>
+#include <engge/Engine/WaitManager.hpp>
 #include <engge/Scripting/ScriptEngine.hpp>
+#include <engge/System/Locator.hpp>
 #include <engge/System/Logger.hpp>
 
 namespace ng {
@@ -21,6 +23,7 @@ void WalkingState::setDestination(const std::vector <glm::vec2> &path, std::opti
 
 void WalkingState::stop() {
   m_isWalking = false;
+  Locator<WaitManager>::get().notify(WaitEvent::Walk, m_pActor->getId());
   m_pActor->getCostume().setStandState();
   if (ScriptEngine::rawExists(m_pActor, "postWalking")) {
     ScriptEngine::objCall(m_pActor, "postWalking");
@@ -1,9 +1,12 @@
+#include <engge/Engine/WaitManager.hpp>
 #include <engge/Graphics/AnimControl.hpp>
+#include <engge/System/Locator.hpp>
 
 namespace ng {
 void AnimControl::setAnimation(Animation *anim) {
   m_anim = anim;
   stop();
+  notifyStopped();
 }
 
 Animation *AnimControl::getAnimation() { return m_anim; }
@@ -28,9 +31,13 @@ void AnimControl::stop() {
     return;
   m_anim->state = AnimState::Stopped;
   resetAnim(*m_anim);
+  notifyStopped();
 }
 
-void AnimControl::pause() { m_anim->state = AnimState::Pause; }
+void AnimControl::pause() {
+  m_anim->state = AnimState::Pause;
+  notifyStopped();
+}
 
 AnimState AnimControl::getState() const {
   if (!m_anim)
@@ -50,6 +57,8 @@ void AnimControl::update(const ngf::TimeSpan &e) {
 
   if (!m_anim->frames.empty()) {
     update(e, *m_anim);
+    if (m_anim->state != AnimState::Play)
+      notifyStopped();
     return;
   }
 
@@ -58,12 +67,20 @@ void AnimControl::update(const ngf::TimeSpan &e) {
     update(e, layer);
     isOver &= layer.state == ng::AnimState::Stopped;
   }
-  if (isOver)
+  if (isOver) {
     m_anim->state = ng::AnimState::Stopped;
+    notifyStopped();
+  }
 }
 
 bool AnimControl::getLoop() const { return m_loop; }
 
+void AnimControl::notifyStopped() const {
+  if (!m_id)
+    return;
+  Locator<WaitManager>::get().notify(WaitEvent::Animation, m_id);
+}
+
 void AnimControl::resetAnim(Animation &anim) {
   if (!anim.frames.empty()) {
     anim.state = ng::AnimState::Stopped;
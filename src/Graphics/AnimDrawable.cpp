@@ -1,6 +1,7 @@
 #include <engge/Graphics/AnimDrawable.hpp>
 #include <engge/Graphics/Animation.hpp>
 #include <engge/Graphics/LightingShader.h>
+#include <engge/Graphics/SpriteBatch.hpp>
 #include <ngf/Math/Transform.h>
 #include <ngf/Graphics/Sprite.h>
 #include <engge/Graphics/ResourceManager.hpp>
@@ -13,6 +14,8 @@ void AnimDrawable::setFlipX(bool flipX) { m_flipX = flipX; }
 
 void AnimDrawable::setColor(const ngf::Color &color) { m_color = color; }
 
+void AnimDrawable::setSpriteBatch(SpriteBatch *pBatch) { m_pBatch = pBatch; }
+
 void AnimDrawable::draw(const glm::vec2 &pos, ngf::RenderTarget &target, ngf::RenderStates states) const {
   if (!m_anim)
     return;
@@ -40,7 +43,7 @@ void AnimDrawable::draw(const glm::vec2 &pos,
   if (!anim.offsets.empty() && anim.frameIndex < static_cast<int>(anim.offsets.size())) {
     offset = anim.offsets.at(anim.frameIndex);
   }
-  const auto frame = anim.frames.at(anim.frameIndex);
+  const auto &frame = anim.frames.at(anim.frameIndex);
   if (frame.isNull)
     return;
 
@@ -58,11 +61,35 @@ void AnimDrawable::draw(const glm::vec2 &pos,
   tFlipX.setScale({m_flipX ? -1 : 1, 1});
   states.transform = tFlipX.getTransform() * t.getTransform() * states.transform;
 
+  // skip the sprites outside of the camera before resolving the texture or setting any uniform
+  if (m_pBatch && !m_pBatch->isVisible(target, frame.frame, states.transform))
+    return;
+
   auto pShader = (LightingShader *) states.shader;
-  auto texture = Locator<ResourceManager>::get().getTexture(anim.texture);
+  if (!anim.pTexture) {
+    // the texture is loaded in the background, the sprite is drawn once it's ready
+    anim.pTexture = Locator<ResourceManager>::get().requestTexture(anim.texture).get();
+  }
+  const auto &texture = anim.pTexture;
   if (!texture)
     return;
 
+  // only the lights reaching the sprite are sent to the shader
+  auto numberLights = pShader->getNumberLights();
+  if (numberLights > 0) {
+    glm::vec2 size{frame.frame.getWidth(), frame.frame.getHeight()};
+    numberLights = pShader->selectLights(ngf::frect::fromPositionSize(pos - size / 2.f, size));
+  }
+
+  // without lights the sprite doesn't need its own uniforms and can be batched
+  if (m_pBatch) {
+    if (numberLights == 0) {
+      m_pBatch->draw(target, *pShader, *texture, frame.frame, states.transform, m_color);
+      return;
+    }
+    m_pBatch->flush();
+  }
+
   auto texSize = texture->getSize();
   pShader->setTexture(*texture);
   pShader->setContentSize(frame.sourceSize);
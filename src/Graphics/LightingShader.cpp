@@ -1,4 +1,6 @@
 #include <engge/Graphics/LightingShader.h>
+#include <algorithm>
+#include <glm/common.hpp>
 
 namespace ng {
 namespace {
@@ -101,23 +103,28 @@ LightingShader::LightingShader() {
 }
 
 void LightingShader::setContentSize(glm::vec2 size) {
-  setUniform("u_contentSize", size);
+  if (needsUpload(m_contentSize, size))
+    setUniform("u_contentSize", size);
 }
 
 void LightingShader::setSpritePosInSheet(glm::vec2 spritePosInSheet) {
-  setUniform("u_spritePosInSheet", spritePosInSheet);
+  if (needsUpload(m_spritePosInSheet, spritePosInSheet))
+    setUniform("u_spritePosInSheet", spritePosInSheet);
 }
 
 void LightingShader::setSpriteSizeRelToSheet(glm::vec2 spriteSizeRelToSheet) {
-  setUniform("u_spriteSizeRelToSheet", spriteSizeRelToSheet);
+  if (needsUpload(m_spriteSizeRelToSheet, spriteSizeRelToSheet))
+    setUniform("u_spriteSizeRelToSheet", spriteSizeRelToSheet);
 }
 
 void LightingShader::setSpriteOffset(glm::vec2 spriteOffset) {
-  setUniform("u_spriteOffset", spriteOffset);
+  if (needsUpload(m_spriteOffset, spriteOffset))
+    setUniform("u_spriteOffset", spriteOffset);
 }
 
 void LightingShader::setAmbientColor(ngf::Color color) {
-  setUniform3("u_ambientColor", color);
+  if (needsUpload(m_ambientUniform, color))
+    setUniform3("u_ambientColor", color);
   m_ambient = color;
 }
 
@@ -128,46 +135,118 @@ void LightingShader::setTexture(const ngf::Texture &texture) {
 }
 
 void LightingShader::setNumberLights(int numberLights) {
-  setUniform("u_numberLights", numberLights);
   m_numberLights = std::min(numberLights, LightingShader::MaxLights);
+  updateNumberLights();
+}
+
+void LightingShader::updateNumberLights() {
+  // the shader only iterates over the lights selected for the current sprite
+  auto numberLights = m_numberLights == 0 ? 0 : m_selectedLights;
+  if (needsUpload(m_numberLightsUniform, numberLights))
+    setUniform("u_numberLights", numberLights);
 }
 
 int LightingShader::getNumberLights() const { return m_numberLights; }
 
-void LightingShader::setLights(const std::array<Light, MaxLights> &lights) {
-  std::array<glm::vec3, MaxLights> u_lightPos{};
-  std::array<glm::vec2, MaxLights> u_coneDirection{};
-  std::array<float, MaxLights> u_coneCosineHalfConeAngle{};
-  std::array<float, MaxLights> u_coneFalloff{};
-  std::array<ngf::Color, MaxLights> u_lightColor;
-  std::array<float, MaxLights> u_brightness{};
-  std::array<float, MaxLights> u_cutoffRadius{};
-  std::array<float, MaxLights> u_halfRadius{};
-
-  int numLights = 0;
-  for (int i = 0; i < m_numberLights; ++i) {
+void LightingShader::setLights(const std::array<Light, MaxLights> &lights, int numberLights) {
+  m_lights.clear();
+  for (int i = 0; i < std::min(numberLights, MaxLights); ++i) {
     auto &light = lights[i];
     if (!light.on)
       continue;
     auto direction = light.coneDirection - 90.f;
-    u_coneDirection[numLights] = glm::vec2(std::cos(glm::radians(direction)), std::sin(glm::radians(direction)));
-    u_coneCosineHalfConeAngle[numLights] = cos(glm::radians(light.coneAngle / 2.f));
-    u_coneFalloff[numLights] = light.coneFalloff;
-    u_lightColor[numLights] = light.color;
-    u_lightPos[numLights] = glm::vec3(light.pos, 1.f);
-    u_brightness[numLights] = light.brightness;
-    u_cutoffRadius[numLights] = std::max(1.0f, light.cutOffRadius);
-    u_halfRadius[numLights] = std::max(0.01f, std::min(0.99f, light.halfRadius));
-    numLights++;
+    LightUniforms uniforms;
+    uniforms.coneDirection = glm::vec2(std::cos(glm::radians(direction)), std::sin(glm::radians(direction)));
+    uniforms.coneCosineHalfConeAngle = cos(glm::radians(light.coneAngle / 2.f));
+    uniforms.coneFalloff = light.coneFalloff;
+    uniforms.color = light.color;
+    uniforms.pos = glm::vec3(light.pos, 1.f);
+    uniforms.brightness = light.brightness;
+    uniforms.cutoffRadius = std::max(1.0f, light.cutOffRadius);
+    uniforms.halfRadius = std::max(0.01f, std::min(0.99f, light.halfRadius));
+    m_lights.push_back(uniforms);
+  }
+  m_lightsChanged = true;
+  m_selectedLights = 0;
+  updateNumberLights();
+}
+
+int LightingShader::selectLights(const ngf::frect &bounds) {
+  // keep only the lights whose cutoff circle intersects the sprite
+  auto center = (bounds.min + bounds.max) / 2.f;
+  auto distance2 = [&center](const LightUniforms *pLight) {
+    auto d = glm::vec2(pLight->pos) - center;
+    return d.x * d.x + d.y * d.y;
+  };
+  m_lightsInRange.clear();
+  for (const auto &light : m_lights) {
+    auto nearest = glm::clamp(glm::vec2(light.pos), bounds.min, bounds.max);
+    auto d = glm::vec2(light.pos) - nearest;
+    if (d.x * d.x + d.y * d.y <= light.cutoffRadius * light.cutoffRadius) {
+      m_lightsInRange.push_back(&light);
+    }
   }
-  m_numberLights = numLights;
-  setUniformArray("u_lightPos", u_lightPos.data(), MaxLights);
-  setUniformArray("u_coneDirection", u_coneDirection.data(), MaxLights);
-  setUniformArray("u_coneCosineHalfConeAngle", u_coneCosineHalfConeAngle.data(), MaxLights);
-  setUniformArray("u_coneFalloff", u_coneFalloff.data(), MaxLights);
-  setUniformArray3("u_lightColor", u_lightColor.data(), MaxLights);
-  setUniformArray("u_brightness", u_brightness.data(), MaxLights);
-  setUniformArray("u_cutoffRadius", u_cutoffRadius.data(), MaxLights);
-  setUniformArray("u_halfRadius", u_halfRadius.data(), MaxLights);
+  if (m_lightsInRange.size() > static_cast<size_t>(MaxLightsPerSprite)) {
+    std::partial_sort(m_lightsInRange.begin(), m_lightsInRange.begin() + MaxLightsPerSprite, m_lightsInRange.end(),
+                      [&distance2](auto pLight1, auto pLight2) { return distance2(pLight1) < distance2(pLight2); });
+    m_lightsInRange.resize(MaxLightsPerSprite);
+  }
+
+  auto numLights = static_cast<int>(m_lightsInRange.size());
+  m_selectedLights = numLights;
+  updateNumberLights();
+  if (numLights == 0)
+    return 0;
+
+  // the arrays are only built again when the selected lights or the lights changed
+  if (!m_lightsChanged && m_lightsInRange == m_uploadedLights)
+    return numLights;
+  m_lightsChanged = false;
+  m_uploadedLights = m_lightsInRange;
+
+  std::array<glm::vec3, MaxLightsPerSprite> u_lightPos{};
+  std::array<glm::vec2, MaxLightsPerSprite> u_coneDirection{};
+  std::array<float, MaxLightsPerSprite> u_coneCosineHalfConeAngle{};
+  std::array<float, MaxLightsPerSprite> u_coneFalloff{};
+  std::array<ngf::Color, MaxLightsPerSprite> u_lightColor;
+  std::array<float, MaxLightsPerSprite> u_brightness{};
+  std::array<float, MaxLightsPerSprite> u_cutoffRadius{};
+  std::array<float, MaxLightsPerSprite> u_halfRadius{};
+
+  for (int i = 0; i < numLights; ++i) {
+    auto pLight = m_lightsInRange[i];
+    u_lightPos[i] = pLight->pos;
+    u_coneDirection[i] = pLight->coneDirection;
+    u_coneCosineHalfConeAngle[i] = pLight->coneCosineHalfConeAngle;
+    u_coneFalloff[i] = pLight->coneFalloff;
+    u_lightColor[i] = pLight->color;
+    u_brightness[i] = pLight->brightness;
+    u_cutoffRadius[i] = pLight->cutoffRadius;
+    u_halfRadius[i] = pLight->halfRadius;
+  }
+
+  // only the arrays whose values changed are sent again
+  if (needsUpload(m_lightPos, u_lightPos))
+    setUniformArray("u_lightPos", u_lightPos.data(), MaxLightsPerSprite);
+  if (needsUpload(m_coneDirection, u_coneDirection))
+    setUniformArray("u_coneDirection", u_coneDirection.data(), MaxLightsPerSprite);
+  if (needsUpload(m_coneCosineHalfConeAngle, u_coneCosineHalfConeAngle))
+    setUniformArray("u_coneCosineHalfConeAngle", u_coneCosineHalfConeAngle.data(), MaxLightsPerSprite);
+  if (needsUpload(m_coneFalloff, u_coneFalloff))
+    setUniformArray("u_coneFalloff", u_coneFalloff.data(), MaxLightsPerSprite);
+  if (needsUpload(m_lightColor, u_lightColor))
+    setUniformArray3("u_lightColor", u_lightColor.data(), MaxLightsPerSprite);
+  if (needsUpload(m_brightness, u_brightness))
+    setUniformArray("u_brightness", u_brightness.data(), MaxLightsPerSprite);
+  if (needsUpload(m_cutoffRadius, u_cutoffRadius))
+    setUniformArray("u_cutoffRadius", u_cutoffRadius.data(), MaxLightsPerSprite);
+  if (needsUpload(m_halfRadius, u_halfRadius))
+    setUniformArray("u_halfRadius", u_halfRadius.data(), MaxLightsPerSprite);
+  return numLights;
+}
+
+void LightingShader::resetUploadStats() {
+  m_issuedUploads = 0;
+  m_skippedUploads = 0;
 }
 }
@@ -0,0 +1,11 @@
+#include "RenderTargetPool.hpp"
+
+namespace ng {
+ngf::RenderTexture &RenderTargetPool::get(RenderTargetId id, const glm::ivec2 &size) {
+  auto &target = m_targets.at(static_cast<size_t>(id));
+  if (!target || target->getSize() != size) {
+    target = std::make_unique<ngf::RenderTexture>(size);
+  }
+  return *target;
+}
+}
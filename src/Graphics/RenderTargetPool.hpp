@@ -0,0 +1,29 @@
+#pragma once
+#include <array>
+#include <memory>
+#include <glm/vec2.hpp>
+#include <ngf/Graphics/RenderTexture.h>
+
+namespace ng {
+enum class RenderTargetId {
+  Room,
+  RoomWithEffect,
+  FadeRoom,
+  FadeRoomWithEffect,
+  Count
+};
+
+/// @brief Keeps the render textures used to compose the room alive between frames.
+class RenderTargetPool final {
+public:
+  /// @brief Gets the render texture with the specified id.
+  /// @details The render texture is only reallocated when the requested size changes.
+  /// \param id Identifier of the render texture.
+  /// \param size Size of the render texture.
+  /// \return The render texture.
+  ngf::RenderTexture &get(RenderTargetId id, const glm::ivec2 &size);
+
+private:
+  std::array<std::unique_ptr<ngf::RenderTexture>, static_cast<size_t>(RenderTargetId::Count)> m_targets;
+};
+}
@@ -4,14 +4,26 @@
 #include "engge/System/Logger.hpp"
 #include "engge/Graphics/ResourceManager.hpp"
 #include "engge/Graphics/SpriteSheet.hpp"
+#include <algorithm>
+#include <chrono>
 #include <ngf/Graphics/FntFont.h>
 #include <ngf/IO/MemoryStream.h>
 
 namespace ng {
+namespace {
+// maximum time spent each frame to create the textures decoded by the workers
+constexpr std::chrono::milliseconds TextureUploadBudget{4};
+
+template<typename T>
+bool isReady(const std::future<T> &result) {
+  return result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+}
+
 ResourceManager::ResourceManager() = default;
 ResourceManager::~ResourceManager() = default;
 
-void ResourceManager::load(const std::string &id) {
+ResourceManager::DecodedImage ResourceManager::decodeImage(const std::string &id) {
   info("Load texture {}", id);
   auto data = Locator<EngineSettings>::get().readBuffer(id);
 
@@ -21,13 +33,40 @@ void ResourceManager::load(const std::string &id) {
   os.close();
 #endif
 
-  ngf::Image img;
-  if (!img.loadFromMemory(data.data(), data.size())) {
+  DecodedImage decodedImage;
+  if (!decodedImage.image.loadFromMemory(data.data(), data.size())) {
     error("Fail to load texture {}", id);
   }
+  decodedImage.size = data.size();
+  return decodedImage;
+}
+
+std::shared_ptr<ngf::Texture> ResourceManager::addTexture(const std::string &id, const DecodedImage &decodedImage) {
+  auto texture = std::make_shared<ngf::Texture>(decodedImage.image);
+  auto textureSize = texture->getSize();
+  auto memory = static_cast<size_t>(textureSize.x) * textureSize.y * 4;
+  m_textureMap.insert(std::make_pair(id, TextureResource{texture, decodedImage.size, memory, ++m_useCount}));
+  m_textureMemory += memory;
+  if (m_evictedTextureNames.erase(id)) {
+    m_reloadedTextures++;
+  }
+  return texture;
+}
+
+void ResourceManager::addDecodedTexture(const std::string &id, const DecodedImage &decodedImage) {
+  if (m_textureMap.find(id) != m_textureMap.end() || m_pendingTextures.find(id) != m_pendingTextures.end())
+    return;
+  addTexture(id, decodedImage);
+}
+
+void ResourceManager::addSpriteSheet(const std::string &id, std::shared_ptr<SpriteSheet> spriteSheet) {
+  if (m_pendingSpriteSheets.find(id) != m_pendingSpriteSheets.end())
+    return;
+  m_spriteSheetMap.insert(std::make_pair(id, std::move(spriteSheet)));
+}
 
-  auto texture = std::make_shared<ngf::Texture>(img);
-  m_textureMap.insert(std::make_pair(id, TextureResource{texture, data.size()}));
+void ResourceManager::load(const std::string &id) {
+  addTexture(id, decodeImage(id));
 }
 
 void ResourceManager::loadFont(const std::string &id) {
@@ -62,12 +101,30 @@ void ResourceManager::loadSpriteSheet(const std::string &id) {
 std::shared_ptr<ngf::Texture> ResourceManager::getTexture(const std::string &id) {
   auto found = m_textureMap.find(id);
   if (found == m_textureMap.end()) {
-    load(id);
+    if (m_pendingTextures.find(id) != m_pendingTextures.end()) {
+      finishTexture(id);
+    } else {
+      load(id);
+    }
     found = m_textureMap.find(id);
   }
+  found->second.lastUse = ++m_useCount;
   return found->second.texture;
 }
 
+void ResourceManager::pinTexture(const std::string &id) {
+  m_pinnedTextures[id]++;
+}
+
+void ResourceManager::unpinTexture(const std::string &id) {
+  auto it = m_pinnedTextures.find(id);
+  if (it == m_pinnedTextures.end())
+    return;
+  if (--it->second == 0) {
+    m_pinnedTextures.erase(it);
+  }
+}
+
 GGFont &ResourceManager::getFont(const std::string &id) {
   auto found = m_fontMap.find(id);
   if (found == m_fontMap.end()) {
@@ -89,10 +146,180 @@ ngf::FntFont &ResourceManager::getFntFont(const std::string &id) {
 const SpriteSheet &ResourceManager::getSpriteSheet(const std::string &id) {
   auto found = m_spriteSheetMap.find(id);
   if (found == m_spriteSheetMap.end()) {
+    if (m_pendingSpriteSheets.find(id) != m_pendingSpriteSheets.end())
+      return *finishSpriteSheet(id);
     loadSpriteSheet(id);
     found = m_spriteSheetMap.find(id);
   }
   return *found->second;
 }
 
+TextureHandle ResourceManager::requestTexture(const std::string &id, JobPriority priority) {
+  auto found = m_textureMap.find(id);
+  if (found != m_textureMap.end()) {
+    found->second.lastUse = ++m_useCount;
+    return TextureHandle(std::make_shared<std::shared_ptr<ngf::Texture>>(found->second.texture));
+  }
+
+  auto pending = m_pendingTextures.find(id);
+  if (pending != m_pendingTextures.end()) {
+    // a texture prefetched is needed now: a job with a normal priority is queued, the first one started decodes it
+    auto &request = pending->second;
+    if (priority == JobPriority::Normal && request.priority == JobPriority::Low && !request.pDecoding->started) {
+      enqueueDecoding(id, request, priority);
+    }
+    return TextureHandle(request.pTexture);
+  }
+
+  // the error has already been logged, the texture is requested each time it's drawn
+  if (m_failedTextureNames.find(id) != m_failedTextureNames.end())
+    return TextureHandle();
+
+  PendingTexture request;
+  request.pDecoding = std::make_shared<ImageDecoding>();
+  request.image = request.pDecoding->image.get_future().share();
+  request.pTexture = std::make_shared<std::shared_ptr<ngf::Texture>>();
+  enqueueDecoding(id, request, priority);
+  TextureHandle handle(request.pTexture);
+  m_pendingTextures.insert(std::make_pair(id, std::move(request)));
+  return handle;
+}
+
+void ResourceManager::cancelTextureRequests(JobPriority priority) {
+  for (auto it = m_pendingTextures.begin(); it != m_pendingTextures.end();) {
+    // the queued jobs do nothing once the decoding is marked as started
+    if (it->second.priority == priority && !it->second.pDecoding->started.exchange(true)) {
+      it = m_pendingTextures.erase(it);
+      continue;
+    }
+    ++it;
+  }
+}
+
+void ResourceManager::decode(const std::string &id, ImageDecoding &decoding) {
+  if (decoding.started.exchange(true))
+    return;
+  try {
+    decoding.image.set_value(decodeImage(id));
+  } catch (...) {
+    decoding.image.set_exception(std::current_exception());
+  }
+}
+
+void ResourceManager::enqueueDecoding(const std::string &id, PendingTexture &request, JobPriority priority) {
+  request.priority = priority;
+  Locator<ThreadPool>::get().enqueue([id, pDecoding = request.pDecoding] { decode(id, *pDecoding); }, priority);
+}
+
+SpriteSheetHandle ResourceManager::requestSpriteSheet(const std::string &id) {
+  auto found = m_spriteSheetMap.find(id);
+  if (found != m_spriteSheetMap.end())
+    return SpriteSheetHandle(std::make_shared<std::shared_ptr<SpriteSheet>>(found->second));
+
+  auto pending = m_pendingSpriteSheets.find(id);
+  if (pending != m_pendingSpriteSheets.end())
+    return SpriteSheetHandle(pending->second.pSpriteSheet);
+
+  PendingSpriteSheet request;
+  request.spriteSheet = Locator<ThreadPool>::get().enqueue([this, id] {
+    info("Load SpriteSheet {}", id);
+    auto spriteSheet = std::make_shared<SpriteSheet>();
+    spriteSheet->setTextureManager(this);
+    spriteSheet->load(id);
+    return spriteSheet;
+  });
+  request.pSpriteSheet = std::make_shared<std::shared_ptr<SpriteSheet>>();
+  SpriteSheetHandle handle(request.pSpriteSheet);
+  m_pendingSpriteSheets.insert(std::make_pair(id, std::move(request)));
+  return handle;
+}
+
+std::shared_ptr<ngf::Texture> ResourceManager::finishTexture(const std::string &id) {
+  auto it = m_pendingTextures.find(id);
+  auto request = std::move(it->second);
+  m_pendingTextures.erase(it);
+
+  // decodes the image now if no worker has started it yet, or waits for the worker
+  decode(id, *request.pDecoding);
+  auto texture = addTexture(id, request.image.get());
+  *request.pTexture = texture;
+  return texture;
+}
+
+std::shared_ptr<SpriteSheet> ResourceManager::finishSpriteSheet(const std::string &id) {
+  auto it = m_pendingSpriteSheets.find(id);
+  auto request = std::move(it->second);
+  m_pendingSpriteSheets.erase(it);
+
+  auto spriteSheet = request.spriteSheet.get();
+  m_spriteSheetMap.insert(std::make_pair(id, spriteSheet));
+  *request.pSpriteSheet = spriteSheet;
+  return spriteSheet;
+}
+
+void ResourceManager::update() {
+  std::vector<std::string> ready;
+  for (const auto &request : m_pendingSpriteSheets) {
+    if (isReady(request.second.spriteSheet)) {
+      ready.push_back(request.first);
+    }
+  }
+  for (const auto &id : ready) {
+    try {
+      auto spriteSheet = finishSpriteSheet(id);
+      requestTexture(spriteSheet->getTextureName());
+    } catch (const std::exception &e) {
+      error("Fail to load SpriteSheet {}: {}", id, e.what());
+    }
+  }
+
+  // the textures have to be created by the main thread, only a few of them are created each frame
+  ready.clear();
+  for (const auto &request : m_pendingTextures) {
+    if (isReady(request.second.image)) {
+      ready.push_back(request.first);
+    }
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (const auto &id : ready) {
+    if (std::chrono::steady_clock::now() - start > TextureUploadBudget)
+      break;
+    try {
+      finishTexture(id);
+    } catch (const std::exception &e) {
+      error("Fail to load texture {}: {}", id, e.what());
+      m_failedTextureNames.insert(id);
+    }
+  }
+
+  evictTextures();
+}
+
+void ResourceManager::evictTextures() {
+  if (m_textureMemory <= m_textureBudget)
+    return;
+
+  // only the textures without any owner outside of the resource manager can be evicted,
+  // the textures of the current room are pinned
+  std::vector<std::map<std::string, TextureResource>::iterator> textures;
+  for (auto it = m_textureMap.begin(); it != m_textureMap.end(); ++it) {
+    if (it->second.texture.use_count() == 1 && m_pinnedTextures.find(it->first) == m_pinnedTextures.end()) {
+      textures.push_back(it);
+    }
+  }
+  std::sort(textures.begin(), textures.end(), [](const auto &it1, const auto &it2) {
+    return it1->second.lastUse < it2->second.lastUse;
+  });
+
+  for (auto it : textures) {
+    if (m_textureMemory <= m_textureBudget)
+      break;
+    trace("Evict texture {}", it->first);
+    m_textureMemory -= it->second.memory;
+    m_evictedTextureNames.insert(it->first);
+    m_evictedTextures++;
+    m_textureMap.erase(it);
+  }
+}
+
 } // namespace ng
@@ -0,0 +1,84 @@
+#include <engge/Graphics/SpriteBatch.hpp>
+#include <engge/Graphics/LightingShader.h>
+#include <limits>
+#include <glm/common.hpp>
+
+namespace ng {
+void SpriteBatch::draw(ngf::RenderTarget &target, LightingShader &shader, const ngf::Texture &texture,
+                       const ngf::irect &rect, const glm::mat3 &transform, const ngf::Color &color) {
+  auto ambient = shader.getAmbientColor();
+  if (m_pTarget != &target || m_pShader != &shader || m_pTexture != &texture || m_ambient != ambient) {
+    flush();
+    m_pTarget = &target;
+    m_pShader = &shader;
+    m_pTexture = &texture;
+    m_ambient = ambient;
+  }
+
+  auto texSize = glm::vec2(texture.getSize());
+  auto size = glm::vec2(rect.getWidth(), rect.getHeight());
+  auto uvMin = glm::vec2(rect.min) / texSize;
+  auto uvMax = (glm::vec2(rect.min) + size) / texSize;
+
+  auto toVertex = [&transform, &color](glm::vec2 pos, glm::vec2 uv) {
+    auto p = glm::vec3(pos, 1.f) * transform;
+    return ngf::Vertex{{p.x, p.y}, color, uv};
+  };
+  auto topLeft = toVertex({0, 0}, uvMin);
+  auto topRight = toVertex({size.x, 0}, {uvMax.x, uvMin.y});
+  auto bottomRight = toVertex(size, uvMax);
+  auto bottomLeft = toVertex({0, size.y}, {uvMin.x, uvMax.y});
+  m_vertices.insert(m_vertices.end(), {topLeft, topRight, bottomRight, topLeft, bottomRight, bottomLeft});
+}
+
+void SpriteBatch::flush() {
+  if (m_vertices.empty())
+    return;
+
+  // the batch is drawn without lights and with the ambient color of the sprites
+  auto ambient = m_pShader->getAmbientColor();
+  auto numberLights = m_pShader->getNumberLights();
+  m_pShader->setAmbientColor(m_ambient);
+  m_pShader->setNumberLights(0);
+  m_pShader->setTexture(*m_pTexture);
+
+  ngf::RenderStates states;
+  states.shader = m_pShader;
+  states.texture = m_pTexture;
+  m_pTarget->draw(ngf::PrimitiveType::Triangles, m_vertices, states);
+  m_vertices.clear();
+
+  m_pShader->setAmbientColor(ambient);
+  m_pShader->setNumberLights(numberLights);
+}
+
+bool SpriteBatch::isVisible(const ngf::RenderTarget &target, const ngf::irect &rect, const glm::mat3 &transform) {
+  const auto &view = target.getView();
+  auto viewMin = view.getCenter() - view.getSize() / 2.f;
+  auto viewMax = view.getCenter() + view.getSize() / 2.f;
+
+  // bounding box of the transformed sprite
+  auto size = glm::vec2(rect.getWidth(), rect.getHeight());
+  glm::vec2 corners[] = {{0, 0}, {size.x, 0}, size, {0, size.y}};
+  glm::vec2 min{std::numeric_limits<float>::max()};
+  glm::vec2 max{std::numeric_limits<float>::lowest()};
+  for (auto corner : corners) {
+    auto p = glm::vec2(glm::vec3(corner, 1.f) * transform);
+    min = glm::min(min, p);
+    max = glm::max(max, p);
+  }
+
+  auto visible = max.x >= viewMin.x && min.x <= viewMax.x && max.y >= viewMin.y && min.y <= viewMax.y;
+  if (visible) {
+    m_drawnSprites++;
+  } else {
+    m_culledSprites++;
+  }
+  return visible;
+}
+
+void SpriteBatch::resetStats() {
+  m_drawnSprites = 0;
+  m_culledSprites = 0;
+}
+}
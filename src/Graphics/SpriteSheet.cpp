@@ -1,24 +1,65 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <thread>
 #include <ngf/IO/Json/JsonParser.h>
 #include "engge/Engine/EngineSettings.hpp"
 #include "engge/System/Locator.hpp"
-#include "../Util/Util.hpp"
+#include "engge/System/Logger.hpp"
 #include "engge/Graphics/SpriteSheet.hpp"
+namespace fs = std::filesystem;
 
 namespace ng {
+namespace {
+constexpr uint32_t CacheMagic = 0x31535345; // ESS1
+constexpr uint32_t CacheVersion = 1;         // to increment when the layout of a frame changes
+constexpr const char *CacheDirectory = "cache";
+
+struct CacheHeader {
+  uint32_t magic;
+  uint32_t version;
+  int64_t time; ///< last modification time of the file containing the sprite sheet
+  uint32_t numFrames;
+  uint32_t namesSize;
+};
+
+ngf::irect toRect(const int32_t rect[4]) {
+  return ngf::irect::fromPositionSize({rect[0], rect[1]}, {rect[2], rect[3]});
+}
+
+void setRect(const ngf::GGPackValue &json, int32_t rect[4]) {
+  rect[0] = json["x"].getInt();
+  rect[1] = json["y"].getInt();
+  rect[2] = json["w"].getInt();
+  rect[3] = json["h"].getInt();
+}
+}
+
 void SpriteSheet::load(const std::string &name) {
   if (m_textureName == name)
     return;
 
   m_textureName = name + ".png";
 
-  m_rects.clear();
-  m_spriteSourceSize.clear();
-  m_sourceSize.clear();
+  // the parsed sprite sheet is cached until the file containing it is modified
+  auto jsonFilename = name + ".json";
+  auto time = static_cast<int64_t>(
+      Locator<EngineSettings>::get().getLastWriteTime(jsonFilename).time_since_epoch().count());
+  auto cachePath = (fs::path(CacheDirectory) / (name + ".sheet")).string();
+  if (loadCache(cachePath, time))
+    return;
+
+  loadJson(jsonFilename);
+  saveCache(cachePath, time);
+}
+
+void SpriteSheet::loadJson(const std::string &jsonFilename) {
+  m_frames.clear();
+  m_names.clear();
 
   ngf::GGPackValue json;
 
   {
-    auto jsonFilename = name + ".json";
     auto buffer = Locator<EngineSettings>::get().readBuffer(jsonFilename);
 
 #if 0
@@ -32,37 +73,123 @@ void SpriteSheet::load(const std::string &name) {
 
   auto jFrames = json["frames"];
   for (auto &it : jFrames.items()) {
-    auto rect = toRect(it.value()["frame"]);
-    m_rects.insert(std::make_pair(it.key(), rect));
-    rect = toRect(it.value()["spriteSourceSize"]);
-    m_spriteSourceSize.insert(std::make_pair(it.key(), rect));
-    auto size = toSize(it.value()["sourceSize"]);
-    m_sourceSize.insert(std::make_pair(it.key(), size));
+    Frame frame{};
+    frame.nameOffset = static_cast<uint32_t>(m_names.size());
+    frame.nameLength = static_cast<uint32_t>(it.key().size());
+    m_names.append(it.key());
+    setRect(it.value()["frame"], frame.frame);
+    setRect(it.value()["spriteSourceSize"], frame.spriteSourceSize);
+    frame.sourceSize[0] = it.value()["sourceSize"]["w"].getInt();
+    frame.sourceSize[1] = it.value()["sourceSize"]["h"].getInt();
+    m_frames.push_back(frame);
   }
+  std::sort(m_frames.begin(), m_frames.end(), [this](const auto &frame1, const auto &frame2) {
+    return getName(frame1) < getName(frame2);
+  });
+}
+
+bool SpriteSheet::loadCache(const std::string &path, int64_t time) {
+  std::error_code ec;
+  auto fileSize = fs::file_size(path, ec);
+  if (ec)
+    return false;
+
+  std::ifstream is(path, std::ios::binary);
+  if (!is.is_open())
+    return false;
+
+  CacheHeader header{};
+  is.read(reinterpret_cast<char *>(&header), sizeof(header));
+  if (!is || header.magic != CacheMagic || header.version != CacheVersion || header.time != time)
+    return false;
+
+  // a truncated or corrupted file must not make us allocate a huge buffer
+  auto expectedSize = sizeof(header) + static_cast<uintmax_t>(header.numFrames) * sizeof(Frame) + header.namesSize;
+  if (expectedSize != fileSize)
+    return false;
+
+  m_frames.resize(header.numFrames);
+  m_names.resize(header.namesSize);
+  is.read(reinterpret_cast<char *>(m_frames.data()), header.numFrames * sizeof(Frame));
+  is.read(m_names.data(), header.namesSize);
+
+  // the names have to be in the names buffer and the frames sorted by name, otherwise the json is loaded
+  auto isValid = is && std::all_of(m_frames.cbegin(), m_frames.cend(), [this](const auto &frame) {
+    return static_cast<uint64_t>(frame.nameOffset) + frame.nameLength <= m_names.size();
+  });
+  isValid = isValid && std::is_sorted(m_frames.cbegin(), m_frames.cend(), [this](const auto &frame1, const auto &frame2) {
+    return getName(frame1) < getName(frame2);
+  });
+  if (!isValid) {
+    m_frames.clear();
+    m_names.clear();
+    return false;
+  }
+  return true;
+}
+
+void SpriteSheet::saveCache(const std::string &path, int64_t time) const {
+  std::error_code ec;
+  fs::create_directories(CacheDirectory, ec);
+
+  // the same sheet can be loaded by several threads: the cache is written in a temporary file first
+  auto tmpPath = path + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+  {
+    std::ofstream os(tmpPath, std::ios::binary);
+    if (!os.is_open()) {
+      warn("Fail to write sprite sheet cache {}", path);
+      return;
+    }
+    CacheHeader header{CacheMagic, CacheVersion, time, static_cast<uint32_t>(m_frames.size()),
+                       static_cast<uint32_t>(m_names.size())};
+    os.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    os.write(reinterpret_cast<const char *>(m_frames.data()), m_frames.size() * sizeof(Frame));
+    os.write(m_names.data(), m_names.size());
+  }
+  fs::rename(tmpPath, path, ec);
+  if (ec) {
+    fs::remove(tmpPath, ec);
+  }
+}
+
+std::string_view SpriteSheet::getName(const Frame &frame) const {
+  return std::string_view(m_names).substr(frame.nameOffset, frame.nameLength);
+}
+
+const SpriteSheet::Frame *SpriteSheet::getFrame(const std::string &name) const {
+  auto it = std::lower_bound(m_frames.cbegin(), m_frames.cend(), name, [this](const auto &frame, const auto &value) {
+    return getName(frame) < value;
+  });
+  if (it == m_frames.cend() || getName(*it) != name)
+    return nullptr;
+  return &(*it);
 }
 
 bool SpriteSheet::hasRect(const std::string &name) const {
-  const auto it = m_rects.find(name);
-  return it != m_rects.end();
+  return getFrame(name) != nullptr;
 }
 
 ngf::irect SpriteSheet::getRect(const std::string &name) const {
-  const auto it = m_rects.find(name);
-  return it->second;
+  const auto pFrame = getFrame(name);
+  return pFrame ? toRect(pFrame->frame) : ngf::irect{};
 }
 
 ngf::irect SpriteSheet::getSpriteSourceSize(const std::string &name) const {
-  const auto it = m_spriteSourceSize.find(name);
-  return it->second;
+  const auto pFrame = getFrame(name);
+  return pFrame ? toRect(pFrame->spriteSourceSize) : ngf::irect{};
 }
 
 glm::ivec2 SpriteSheet::getSourceSize(const std::string &name) const {
-  const auto it = m_sourceSize.find(name);
-  return it->second;
+  const auto pFrame = getFrame(name);
+  return pFrame ? glm::ivec2(pFrame->sourceSize[0], pFrame->sourceSize[1]) : glm::ivec2{};
 }
 
 [[nodiscard]] SpriteSheetItem SpriteSheet::getItem(const std::string &name) const {
-  return SpriteSheetItem{name, getRect(name), getSpriteSourceSize(name), getSourceSize(name), false};
+  const auto pFrame = getFrame(name);
+  if (!pFrame)
+    return SpriteSheetItem{name, {}, {}, {}, false};
+  return SpriteSheetItem{name, toRect(pFrame->frame), toRect(pFrame->spriteSourceSize),
+                         glm::ivec2(pFrame->sourceSize[0], pFrame->sourceSize[1]), false};
 }
 
 } // namespace ng
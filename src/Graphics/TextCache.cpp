@@ -0,0 +1,30 @@
+#include <engge/Graphics/TextCache.hpp>
+
+namespace ng {
+ng::Text &TextCache::get(const std::wstring &string, const ngf::Font &font, const ngf::Color &color, float maxWidth) {
+  auto [it, inserted] =
+      m_texts.try_emplace(Key{string, &font, maxWidth, color.r, color.g, color.b, color.a});
+  auto &entry = it->second;
+  entry.used = true;
+  if (inserted) {
+    if (maxWidth > 0.f) {
+      entry.text.setMaxWidth(maxWidth);
+    }
+    entry.text.setFont(font);
+    entry.text.setColor(color);
+    entry.text.setWideString(string);
+  }
+  return entry.text;
+}
+
+void TextCache::purge() {
+  for (auto it = m_texts.begin(); it != m_texts.end();) {
+    if (!it->second.used) {
+      it = m_texts.erase(it);
+      continue;
+    }
+    it->second.used = false;
+    ++it;
+  }
+}
+}
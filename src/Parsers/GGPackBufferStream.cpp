@@ -3,8 +3,8 @@
 
 GGPackBufferStream::GGPackBufferStream(std::vector<char> input) : m_input(std::move(input)) {}
 
-void GGPackBufferStream::setBuffer(const std::vector<char> &input) {
-  m_input = input;
+void GGPackBufferStream::setBuffer(std::vector<char> input) {
+  m_input = std::move(input);
   m_offset = 0;
 }
 
@@ -68,7 +68,7 @@ void YackTokenReader::load(const std::string &path) {
   o.close();
 #endif
 
-  m_stream.setBuffer(buffer);
+  m_stream.setBuffer(std::move(buffer));
 }
 
 YackTokenReader::iterator YackTokenReader::begin() {
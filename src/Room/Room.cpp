@@ -3,6 +3,7 @@
 #include <engge/Engine/Light.hpp>
 #include <engge/System/Locator.hpp>
 #include <engge/System/Logger.hpp>
+#include <engge/System/ThreadPool.hpp>
 #include <engge/Engine/EntityManager.hpp>
 #include <engge/Room/RoomLayer.hpp>
 #include <engge/Room/RoomScaling.hpp>
@@ -15,7 +16,10 @@
 #include <algorithm>
 #include <iostream>
 #include <cmath>
+#include <chrono>
+#include <future>
 #include <memory>
+#include <set>
 #include <ngf/Math/PathFinding/PathFinder.h>
 #include <ngf/Math/PathFinding/Walkbox.h>
 #include <ngf/Graphics/RectangleShape.h>
@@ -27,6 +31,24 @@ struct CmpLayer {
   bool operator()(int a, int b) const { return a > b; }
 };
 
+namespace {
+void releaseTexture(const Animation &anim) {
+  anim.pTexture.reset();
+  for (const auto &layer : anim.layers) {
+    releaseTexture(layer);
+  }
+}
+
+void getTextureNames(const Animation &anim, std::set<std::string> &names) {
+  if (!anim.texture.empty()) {
+    names.insert(anim.texture);
+  }
+  for (const auto &layer : anim.layers) {
+    getTextureNames(layer, names);
+  }
+}
+}
+
 struct Room::Impl {
   ResourceManager &_textureManager;
   std::vector<std::unique_ptr<Object>> _objects;
@@ -48,11 +70,17 @@ struct Room::Impl {
   Room *_pRoom{nullptr};
   std::array<Light, LightingShader::MaxLights> _lights;
   int _numLights{0};
+  bool _lightsDirty{true}; ///< true when a light has been modified since the lights were sent to the shader
   float _rotation{0};
   LightingShader _lightingShader;
+  SpriteBatch _spriteBatch;
   int _selectedEffect{RoomEffectConstants::EFFECT_NONE};
   ngf::Color _overlayColor{ngf::Colors::Transparent};
   bool _pseudoRoom{false};
+  std::string _wimpyFilename;
+  bool _loaded{true}; ///< false until the backgrounds, the layers and the walkboxes are loaded
+  std::future<ngf::GGPackValue> _pendingWimpy; ///< wimpy file read in the background by warmUp
+  std::vector<std::string> _pinnedTextures;     ///< textures pinned while the room is the current room
 
   explicit Impl(HSQOBJECT roomTable)
       : _textureManager(Locator<ResourceManager>::get()),
@@ -71,9 +99,6 @@ struct Room::Impl {
 
   void loadBackgrounds(ngf::GGPackValue &jWimpy) {
     int width = 0;
-    if (!jWimpy["fullscreen"].isNull()) {
-      _fullscreen = jWimpy["fullscreen"].getInt();
-    }
     _layers[0]->setTexture(_spriteSheet.getTextureName());
     auto screenHeight = _pRoom->getScreenSize().y;
     auto offsetY = screenHeight - _pRoom->getRoomSize().y;
@@ -375,6 +400,29 @@ struct Room::Impl {
     _pf.reset();
   }
 
+  void ensureLoaded() {
+    if (_loaded)
+      return;
+
+    trace("Load room layers {}", _wimpyFilename);
+    // the room file is read now if the worker has not read it yet, it can be queued behind the prefetched textures
+    auto isWimpyReady = _pendingWimpy.valid()
+        && _pendingWimpy.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    auto hash = isWimpyReady ? _pendingWimpy.get() : Locator<EngineSettings>::get().readEntry(_wimpyFilename);
+    _pendingWimpy = {};
+
+    // a previous attempt may have failed in the middle of the loading
+    for (auto &layer : _layers) {
+      layer.second->getBackgrounds().clear();
+    }
+    _walkboxes.clear();
+
+    loadBackgrounds(hash);
+    loadLayers(hash);
+    loadWalkboxes(hash);
+    _loaded = true;
+  }
+
   bool updateGraph(const glm::vec2 &start) {
     _graphWalkboxes.clear();
     if (!_walkboxes.empty()) {
@@ -444,9 +492,13 @@ const std::vector<std::unique_ptr<Object>> &Room::getObjects() const { return m_
 
 std::array<Light, LightingShader::MaxLights> &Room::getLights() { return m_pImpl->_lights; }
 
-std::vector<ngf::Walkbox> &Room::getWalkboxes() { return m_pImpl->_walkboxes; }
+std::vector<ngf::Walkbox> &Room::getWalkboxes() {
+  m_pImpl->ensureLoaded();
+  return m_pImpl->_walkboxes;
+}
 
 const ngf::Walkbox *Room::getWalkbox(const std::string &name) const {
+  m_pImpl->ensureLoaded();
   auto it = std::find_if(m_pImpl->_walkboxes.begin(), m_pImpl->_walkboxes.end(), [&name](const auto &w) {
     return w.getName() == name;
   });
@@ -456,7 +508,10 @@ const ngf::Walkbox *Room::getWalkbox(const std::string &name) const {
   return nullptr;
 }
 
-std::vector<ngf::Walkbox> &Room::getGraphWalkboxes() { return m_pImpl->_graphWalkboxes; }
+std::vector<ngf::Walkbox> &Room::getGraphWalkboxes() {
+  m_pImpl->ensureLoaded();
+  return m_pImpl->_graphWalkboxes;
+}
 
 glm::ivec2 Room::getRoomSize() const { return m_pImpl->_roomSize; }
 
@@ -509,15 +564,29 @@ void Room::load(const char *name) {
   m_pImpl->_sheet = hash["sheet"].getString();
   m_pImpl->_screenHeight = hash["height"].getInt();
   m_pImpl->_roomSize = (glm::ivec2) parsePos(hash["roomsize"].getString());
+  if (!hash["fullscreen"].isNull()) {
+    m_pImpl->_fullscreen = hash["fullscreen"].getInt();
+  }
 
-  // load json file
+  // load json file, the animations of the objects need it
   m_pImpl->_spriteSheet.load(m_pImpl->_sheet);
 
-  m_pImpl->loadBackgrounds(hash);
-  m_pImpl->loadLayers(hash);
   m_pImpl->loadObjects(hash);
   m_pImpl->loadScalings(hash);
-  m_pImpl->loadWalkboxes(hash);
+
+  // the backgrounds, the layers and the walkboxes are loaded when the room is entered
+  m_pImpl->_wimpyFilename = wimpyFilename;
+  m_pImpl->_loaded = false;
+}
+
+void Room::ensureLoaded() { m_pImpl->ensureLoaded(); }
+
+void Room::warmUp() {
+  if (m_pImpl->_loaded || m_pImpl->_pendingWimpy.valid())
+    return;
+  m_pImpl->_pendingWimpy = Locator<ThreadPool>::get().enqueue([filename = m_pImpl->_wimpyFilename] {
+    return Locator<EngineSettings>::get().readEntry(filename);
+  }, JobPriority::Low);
 }
 
 TextObject &Room::createTextObject(const std::string &fontName) {
@@ -582,6 +651,7 @@ Object &Room::createObject(const std::string &image) {
   ngf::irect rect = ngf::irect::fromPositionSize({0, 0}, size);
   anim.name = "state0";
   anim.texture = name + ".png";
+  anim.pTexture = texture;
   anim.frames.push_back(SpriteSheetItem{"state0", rect, rect, size, false});
   object->getAnims().push_back(anim);
 
@@ -633,11 +703,16 @@ void Room::update(const ngf::TimeSpan &elapsed) {
 }
 
 void Room::draw(ngf::RenderTarget &target, const glm::vec2 &cameraPos) const {
-  // update lighting
+  m_pImpl->_spriteBatch.resetStats();
+
+  // update lighting, the lights are only prepared again when one of them has been modified
   auto nLights = m_pImpl->_numLights;
   m_pImpl->_lightingShader.setAmbientColor(m_pImpl->_ambientColor);
   m_pImpl->_lightingShader.setNumberLights(nLights);
-  m_pImpl->_lightingShader.setLights(m_pImpl->_lights);
+  if (m_pImpl->_lightsDirty) {
+    m_pImpl->_lightingShader.setLights(m_pImpl->_lights, nLights);
+    m_pImpl->_lightsDirty = false;
+  }
 
   for (const auto &layer : m_pImpl->_layers) {
     auto parallax = layer.second->getParallax();
@@ -647,7 +722,7 @@ void Room::draw(ngf::RenderTarget &target, const glm::vec2 &cameraPos) const {
     ngf::RenderStates states;
     states.shader = &m_pImpl->_lightingShader;
     states.transform = t.getTransform();
-    layer.second->draw(target, states);
+    layer.second->draw(target, states, m_pImpl->_spriteBatch);
   }
 }
 
@@ -672,6 +747,7 @@ const RoomScaling &Room::getRoomScaling() const { return m_pImpl->_scaling; }
 void Room::setRoomScaling(const RoomScaling &scaling) { m_pImpl->_scaling = scaling; }
 
 void Room::setWalkboxEnabled(const std::string &name, bool isEnabled) {
+  m_pImpl->ensureLoaded();
   auto it = std::find_if(m_pImpl->_walkboxes.begin(), m_pImpl->_walkboxes.end(),
                          [&name](const auto &walkbox) { return walkbox.getName() == name; });
   if (it == m_pImpl->_walkboxes.end()) {
@@ -685,6 +761,7 @@ void Room::setWalkboxEnabled(const std::string &name, bool isEnabled) {
 std::vector<RoomScaling> &Room::getScalings() { return m_pImpl->_scalings; }
 
 std::vector<glm::vec2> Room::calculatePath(glm::vec2 start, glm::vec2 end) const {
+  m_pImpl->ensureLoaded();
   if (!m_pImpl->_pf) {
     if (!m_pImpl->updateGraph(start)) {
       return std::vector<glm::vec2>();
@@ -705,13 +782,54 @@ Light *Room::createLight(ngf::Color color, glm::ivec2 pos) {
   auto &light = m_pImpl->_lights[m_pImpl->_numLights++];
   light.color = color;
   light.pos = pos;
+  m_pImpl->_lightsDirty = true;
   return &light;
 }
 
 int Room::getNumberLights() const { return m_pImpl->_numLights; }
 
+void Room::setLightsDirty() { m_pImpl->_lightsDirty = true; }
+
 LightingShader& Room::getLightingShader() { return m_pImpl->_lightingShader; }
 
+SpriteBatch &Room::getSpriteBatch() const { return m_pImpl->_spriteBatch; }
+
+void Room::pinTextures() {
+  if (!m_pImpl->_pinnedTextures.empty())
+    return;
+
+  std::set<std::string> names;
+  for (const auto &layer : m_pImpl->_layers) {
+    if (!layer.second->getTextureName().empty()) {
+      names.insert(layer.second->getTextureName());
+    }
+  }
+  for (const auto &pObj : m_pImpl->_objects) {
+    for (const auto &anim : pObj->getAnims()) {
+      getTextureNames(anim, names);
+    }
+  }
+  for (const auto &name : names) {
+    m_pImpl->_textureManager.pinTexture(name);
+    m_pImpl->_pinnedTextures.push_back(name);
+  }
+}
+
+void Room::releaseTextures() {
+  for (const auto &name : m_pImpl->_pinnedTextures) {
+    m_pImpl->_textureManager.unpinTexture(name);
+  }
+  m_pImpl->_pinnedTextures.clear();
+  for (auto &layer : m_pImpl->_layers) {
+    layer.second->releaseTexture();
+  }
+  for (auto &pObj : m_pImpl->_objects) {
+    for (const auto &anim : pObj->getAnims()) {
+      releaseTexture(anim);
+    }
+  }
+}
+
 void Room::exit() {
   m_pImpl->_numLights = 0;
   for (auto &obj : m_pImpl->_objects) {
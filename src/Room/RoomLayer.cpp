@@ -1,25 +1,64 @@
-#include <ngf/Graphics/Sprite.h>
+#include <ngf/Math/Transform.h>
 #include <engge/Graphics/LightingShader.h>
 #include "engge/Room/RoomLayer.hpp"
 #include "engge/Graphics/ResourceManager.hpp"
 #include "engge/System/Locator.hpp"
 
 namespace ng {
+namespace {
+bool isDrawnBefore(const Entity &a, const Entity &b) {
+  if (a.getZOrder() == b.getZOrder())
+    return a.getId() < b.getId();
+  return a.getZOrder() > b.getZOrder();
+}
+}
+
 RoomLayer::RoomLayer() = default;
 
 void RoomLayer::setTexture(const std::string &textureName) {
   m_textureName = textureName;
+  m_texture.reset();
 }
 
-void RoomLayer::addEntity(Entity &entity) { m_entities.emplace_back(entity); }
+void RoomLayer::addEntity(Entity &entity) {
+  m_entities.emplace_back(entity);
+  m_drawOrder.emplace_back(entity);
+  m_drawOrderChanged = true;
+}
 
 void RoomLayer::removeEntity(Entity &entity) {
   m_entities.erase(std::remove_if(m_entities.begin(), m_entities.end(),
                                   [&entity](auto &pEntity) -> bool { return &pEntity.get() == &entity; }),
                    m_entities.end());
+  m_drawOrder.erase(std::remove_if(m_drawOrder.begin(), m_drawOrder.end(),
+                                   [&entity](auto &pEntity) -> bool { return &pEntity.get() == &entity; }),
+                    m_drawOrder.end());
+}
+
+void RoomLayer::sortEntities() const {
+  auto changed = m_drawOrderChanged;
+  for (Entity &entity : m_drawOrder) {
+    if (entity.hasZOrderChanged()) {
+      entity.resetZOrderChanged();
+      changed = true;
+    }
+  }
+  if (!changed)
+    return;
+
+  // the order changes only a little between two frames: an insertion sort is almost linear
+  for (size_t i = 1; i < m_drawOrder.size(); ++i) {
+    auto entity = m_drawOrder[i];
+    auto j = i;
+    for (; j > 0 && isDrawnBefore(entity, m_drawOrder[j - 1]); --j) {
+      m_drawOrder[j] = m_drawOrder[j - 1];
+    }
+    m_drawOrder[j] = entity;
+  }
+  m_drawOrderChanged = false;
 }
 
-void RoomLayer::draw(ngf::RenderTarget &target, ngf::RenderStates states) const {
+void RoomLayer::draw(ngf::RenderTarget &target, ngf::RenderStates states, SpriteBatch &batch) const {
   if (!m_enabled)
     return;
 
@@ -31,37 +70,29 @@ void RoomLayer::draw(ngf::RenderTarget &target, ngf::RenderStates states) const
   pShader->setNumberLights(0);
 
   // sort entities by z-order
-  std::vector<std::reference_wrapper<Entity>> entities;
-  std::copy(m_entities.begin(), m_entities.end(), std::back_inserter(entities));
-  std::sort(entities.begin(), entities.end(),
-            [](const Entity &a, const Entity &b) {
-              if (a.getZOrder() == b.getZOrder())
-                return a.getId() < b.getId();
-              return a.getZOrder() > b.getZOrder();
-            });
+  sortEntities();
 
   float offsetX = 0.f;
-  // draw layer sprites
+  // draw layer sprites, they are never lit so they can all be batched
+  if (!m_texture && !m_backgrounds.empty()) {
+    m_texture = Locator<ResourceManager>::get().requestTexture(m_textureName).get();
+  }
   for (const auto &item : m_backgrounds) {
-    auto texture = Locator<ResourceManager>::get().getTexture(m_textureName);
-    auto texSize = texture->getSize();
-    pShader->setTexture(*texture);
-    pShader->setContentSize(item.sourceSize);
-    pShader->setSpriteOffset({0, -item.frame.getHeight()});
-    pShader->setSpritePosInSheet({static_cast<float>(item.frame.min.x) / texSize.x,
-                                  static_cast<float>(item.frame.min.y) / texSize.y});
-    pShader->setSpriteSizeRelToSheet({static_cast<float>(item.sourceSize.x) / texSize.x,
-                                      static_cast<float>(item.sourceSize.y) / texSize.y});
-
-    ngf::Sprite s(*texture, item.frame);
+    // the texture is loaded in the background, the sprites are drawn once it's ready
+    if (!m_texture)
+      break;
+    ngf::Transform t;
     glm::vec2 off{item.spriteSourceSize.min.x, item.spriteSourceSize.min.y + m_roomSizeY - item.sourceSize.y};
-    s.getTransform().setPosition(off + glm::vec2{offsetX, m_offsetY});
+    t.setPosition(off + glm::vec2{offsetX, m_offsetY});
     offsetX += item.frame.getWidth();
-    s.draw(target, states);
+    auto transform = t.getTransform() * states.transform;
+    if (!batch.isVisible(target, item.frame, transform))
+      continue;
+    batch.draw(target, *pShader, *m_texture, item.frame, transform, ngf::Colors::White);
   }
 
   // draw layer entities: actors and objects
-  for (const Entity &entity : entities) {
+  for (const Entity &entity : m_drawOrder) {
     if (entity.hasParent())
       continue;
 
@@ -70,6 +101,7 @@ void RoomLayer::draw(ngf::RenderTarget &target, ngf::RenderStates states) const
     pShader->setNumberLights(entity.isLit() ? count : 0);
     entity.draw(target, states);
   }
+  batch.flush();
 
   pShader->setAmbientColor(ambient);
   pShader->setNumberLights(count);
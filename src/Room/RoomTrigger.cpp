@@ -1,5 +1,6 @@
 #include "RoomTrigger.hpp"
 #include "RoomTriggerThread.hpp"
+#include <engge/Engine/EntityManager.hpp>
 #include <engge/System/Locator.hpp>
 #include <engge/System/Logger.hpp>
 #include <engge/Entities/Object.hpp>
@@ -51,17 +52,10 @@ RoomTrigger::~RoomTrigger() {
 }
 
 HSQUIRRELVM RoomTrigger::createThread() {
-  HSQOBJECT thread_obj{};
-  sq_resetobject(&thread_obj);
-
-  HSQUIRRELVM thread = sq_newthread(m_vm, 1024);
-  if (SQ_FAILED(sq_getstackobj(m_vm, -1, &thread_obj))) {
-    error("Couldn't get coroutine thread from stack");
-    return {};
-  }
+  auto thread_obj = ScriptEngine::getThreadVmPool().acquire(m_vm);
+  HSQUIRRELVM thread = thread_obj._unVal.pThread;
 
   auto pUniquethread = std::make_unique<RoomTriggerThread>(m_vm, m_name, thread_obj);
-  sq_pop(m_vm , 1); // pop thread
   m_id = pUniquethread->getId();
   trace("start room trigger thread: {}", m_id);
   m_engine.addThread(std::move(pUniquethread));
@@ -125,6 +119,10 @@ void RoomTrigger::callTrigger(std::vector<HSQOBJECT> &params, const std::string
   trace("call room {} trigger ({})", name, m_id);
   if (SQ_FAILED(sq_call(thread, params.size() - 1, SQFalse, SQTrue))) {
     error("failed to call room {} trigger", name);
+    auto pThread = EntityManager::getThreadFromId(m_id);
+    if (pThread) {
+      pThread->setFailed();
+    }
     return;
   }
 }
@@ -1,14 +1,14 @@
 #include "RoomTriggerThread.hpp"
+#include <engge/Scripting/ScriptEngine.hpp>
 #include <utility>
 
 namespace ng {
 RoomTriggerThread::RoomTriggerThread(HSQUIRRELVM vm, std::string name, HSQOBJECT thread_obj)
     : m_vm(vm), m_name(std::move(name)), m_thread_obj(thread_obj) {
-  sq_addref(m_vm, &m_thread_obj);
 }
 
 RoomTriggerThread::~RoomTriggerThread() {
-  sq_release(m_vm, &m_thread_obj);
+  ScriptEngine::getThreadVmPool().release(m_vm, m_thread_obj, hasFailed());
 }
 
 HSQUIRRELVM RoomTriggerThread::getThread() const {
@@ -6,6 +6,7 @@
 namespace ng {
 class RoomTriggerThread final : public ThreadBase {
 public:
+  /// @brief Creates a trigger thread, it takes the ownership of thread_obj acquired from the thread VM pool.
   RoomTriggerThread(HSQUIRRELVM vm, std::string name, HSQOBJECT thread_obj);
   ~RoomTriggerThread() override;
 
@@ -3,12 +3,48 @@
 #include "DefaultScriptExecute.hpp"
 
 namespace ng {
+DefaultScriptExecute::~DefaultScriptExecute() {
+  for (auto &compiledCode : m_compiledCodes) {
+    sq_release(m_vm, &compiledCode.closure);
+  }
+}
+
+bool DefaultScriptExecute::pushClosure(const std::string &code) {
+  // the same conditions are executed every frame, they are compiled only once
+  auto it = m_compiledCodeMap.find(code);
+  if (it != m_compiledCodeMap.end()) {
+    m_hits++;
+    m_compiledCodes.splice(m_compiledCodes.begin(), m_compiledCodes, it->second);
+    sq_pushobject(m_vm, it->second->closure);
+    return true;
+  }
+
+  m_misses++;
+  if (SQ_FAILED(sq_compilebuffer(m_vm, code.data(), code.size(), _SC("_DefaultScriptExecute"), SQTrue)))
+    return false;
+
+  HSQOBJECT closure;
+  sq_resetobject(&closure);
+  sq_getstackobj(m_vm, -1, &closure);
+  sq_addref(m_vm, &closure);
+  m_compiledCodes.push_front({code, closure});
+  m_compiledCodeMap[m_compiledCodes.front().code] = m_compiledCodes.begin();
+
+  if (m_compiledCodes.size() > MaxCompiledCodes) {
+    auto &leastRecentlyUsed = m_compiledCodes.back();
+    m_compiledCodeMap.erase(leastRecentlyUsed.code);
+    sq_release(m_vm, &leastRecentlyUsed.closure);
+    m_compiledCodes.pop_back();
+  }
+  return true;
+}
+
 void DefaultScriptExecute::execute(const std::string &code) {
   sq_resetobject(&m_result);
   auto top = sq_gettop(m_vm);
 // compile
   sq_pushroottable(m_vm);
-  if (SQ_FAILED(sq_compilebuffer(m_vm, code.data(), code.size(), _SC("_DefaultScriptExecute"), SQTrue))) {
+  if (!pushClosure(code)) {
     error("Error executing code {}", code);
     return;
   }
@@ -57,6 +93,10 @@ std::string DefaultScriptExecute::executeDollar(const std::string &code) {
   return sq_objtostring(&m_result);
 }
 
+ScriptExecuteStats DefaultScriptExecute::getStats() const {
+  return {m_hits, m_misses, m_compiledCodes.size(), MaxCompiledCodes};
+}
+
 SoundDefinition *DefaultScriptExecute::getSoundDefinition(const std::string &name) {
   auto top = sq_gettop(m_vm);
   sq_pushroottable(m_vm);
@@ -1,4 +1,7 @@
 #pragma once
+#include <list>
+#include <string_view>
+#include <unordered_map>
 #include <squirrel.h>
 #include "engge/Scripting/ScriptExecute.hpp"
 
@@ -6,15 +9,32 @@ namespace ng {
 class DefaultScriptExecute final : public ScriptExecute {
 public:
   explicit DefaultScriptExecute(HSQUIRRELVM vm) : m_vm(vm) {}
+  ~DefaultScriptExecute() override;
 
 public:
   void execute(const std::string &code) override;
   bool executeCondition(const std::string &code) override;
   std::string executeDollar(const std::string &code) override;
   SoundDefinition *getSoundDefinition(const std::string &name) override;
+  [[nodiscard]] ScriptExecuteStats getStats() const override;
 
 private:
+  struct CompiledCode {
+    std::string code;
+    HSQOBJECT closure;
+  };
+
+private:
+  bool pushClosure(const std::string &code);
+
+private:
+  static constexpr size_t MaxCompiledCodes = 256;
+
   HSQUIRRELVM m_vm{};
   HSQOBJECT m_result{};
+  std::list<CompiledCode> m_compiledCodes; ///< the most recently used code first
+  std::unordered_map<std::string_view, std::list<CompiledCode>::iterator> m_compiledCodeMap;
+  int m_hits{0};
+  int m_misses{0};
 };
 }
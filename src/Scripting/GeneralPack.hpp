@@ -263,7 +263,7 @@ private:
     } else {
       buffer = settings.readBuffer(name);
     }
-    GGPackBufferStream input(buffer);
+    GGPackBufferStream input(std::move(buffer));
     std::string line;
 
     sq_newarray(v, 0);
@@ -4,6 +4,7 @@
 #include "engge/Engine/Engine.hpp"
 #include "engge/Engine/EngineSettings.hpp"
 #include "engge/Engine/Function.hpp"
+#include "engge/Engine/TimeFunction.hpp"
 #include "engge/Engine/Light.hpp"
 #include "engge/System/Locator.hpp"
 #include "../Room/RoomTrigger.hpp"
@@ -126,6 +127,17 @@ private:
     return 1;
   }
 
+  static void _setLightsDirty(const Light *pLight) {
+    // the lights are sent again to the shader of the room owning the light
+    for (auto &&pRoom : g_pEngine->getRooms()) {
+      const auto &lights = pRoom->getLights();
+      if (pLight >= lights.data() && pLight < lights.data() + lights.size()) {
+        pRoom->setLightsDirty();
+        return;
+      }
+    }
+  }
+
   static SQInteger lightBrightness(HSQUIRRELVM v) {
     Light *pLight;
     if (!EntityManager::tryGetLight(v, 2, pLight))
@@ -139,6 +151,7 @@ private:
       return sq_throwerror(v, _SC("failed to get brightness"));
 
     pLight->brightness = brightness;
+    _setLightsDirty(pLight);
     return 0;
   }
 
@@ -155,6 +168,7 @@ private:
       return sq_throwerror(v, _SC("failed to get direction"));
     }
     pLight->coneDirection = direction;
+    _setLightsDirty(pLight);
     return 0;
   }
 
@@ -171,6 +185,7 @@ private:
       return sq_throwerror(v, _SC("failed to get angle"));
     }
     pLight->coneAngle = angle;
+    _setLightsDirty(pLight);
     return 0;
   }
 
@@ -187,6 +202,7 @@ private:
       return sq_throwerror(v, _SC("failed to get falloff"));
     }
     pLight->coneFalloff = falloff;
+    _setLightsDirty(pLight);
     return 0;
   }
 
@@ -203,6 +219,7 @@ private:
       return sq_throwerror(v, _SC("failed to get cutOffRadius"));
     }
     pLight->cutOffRadius = cutOffRadius;
+    _setLightsDirty(pLight);
     return 0;
   }
 
@@ -219,6 +236,7 @@ private:
       return sq_throwerror(v, _SC("failed to get halfRadius"));
     }
     pLight->halfRadius = halfRadius;
+    _setLightsDirty(pLight);
     return 0;
   }
 
@@ -235,6 +253,7 @@ private:
       return sq_throwerror(v, _SC("failed to get on"));
     }
     pLight->on = (on != 0);
+    _setLightsDirty(pLight);
     return 0;
   }
 
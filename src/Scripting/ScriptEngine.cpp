@@ -1,4 +1,6 @@
 #include <cstdarg>
+#include <filesystem>
+#include <fstream>
 #include <squirrel.h>
 #include "../../extlibs/squirrel/squirrel/sqpcheader.h"
 #include "../../extlibs/squirrel/squirrel/sqvm.h"
@@ -95,6 +97,79 @@ static Platform _getPlatform() {
 #endif
 }
 
+// the compiled scripts are cached until their code is modified
+static constexpr uint32_t ScriptCacheMagic = 0x31435345; // ESC1
+static constexpr const char *ScriptCacheDirectory = "cache";
+
+struct ScriptCacheHeader {
+  uint32_t magic;
+  uint32_t version; ///< version of squirrel which has compiled the script
+  uint64_t hash;    ///< hash of the code of the script
+};
+
+static uint64_t _getHash(const std::vector<char> &code) {
+  // FNV-1a
+  uint64_t hash = 14695981039346656037ULL;
+  for (auto c : code) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+static SQInteger _readCache(SQUserPointer up, SQUserPointer data, SQInteger size) {
+  auto &is = *static_cast<std::ifstream *>(up);
+  is.read(static_cast<char *>(data), size);
+  return static_cast<SQInteger>(is.gcount());
+}
+
+static SQInteger _writeCache(SQUserPointer up, SQUserPointer data, SQInteger size) {
+  auto &os = *static_cast<std::ofstream *>(up);
+  os.write(static_cast<const char *>(data), size);
+  return os ? size : -1;
+}
+
+// pushes the closure of the compiled script if it's in the cache and if it's up to date
+static bool _loadCompiledScript(HSQUIRRELVM v, const std::filesystem::path &path, uint64_t hash) {
+  std::ifstream is(path, std::ios::binary);
+  if (!is.is_open())
+    return false;
+
+  ScriptCacheHeader header{};
+  is.read(reinterpret_cast<char *>(&header), sizeof(header));
+  if (!is || header.magic != ScriptCacheMagic || header.version != SQUIRREL_VERSION_NUMBER || header.hash != hash)
+    return false;
+  return SQ_SUCCEEDED(sq_readclosure(v, _readCache, &is));
+}
+
+// saves the closure of the compiled script on the top of the stack
+static void _saveCompiledScript(HSQUIRRELVM v, const std::filesystem::path &path, uint64_t hash) {
+  std::error_code ec;
+  std::filesystem::create_directories(ScriptCacheDirectory, ec);
+
+  auto tmpPath = path;
+  tmpPath += ".tmp";
+  {
+    std::ofstream os(tmpPath, std::ios::binary);
+    if (!os.is_open()) {
+      warn("Fail to write script cache {}", path.string());
+      return;
+    }
+    ScriptCacheHeader header{ScriptCacheMagic, SQUIRREL_VERSION_NUMBER, hash};
+    os.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    if (SQ_FAILED(sq_writeclosure(v, _writeCache, &os))) {
+      warn("Fail to write script cache {}", path.string());
+      os.close();
+      std::filesystem::remove(tmpPath, ec);
+      return;
+    }
+  }
+  std::filesystem::rename(tmpPath, path, ec);
+  if (ec) {
+    std::filesystem::remove(tmpPath, ec);
+  }
+}
+
 ScriptEngine::ScriptEngine() {
   m_vm = sq_open(1024 * 2);
   sq_setcompilererrorhandler(m_vm, errorHandler);
@@ -249,6 +324,7 @@ ScriptEngine::ScriptEngine() {
 }
 
 ScriptEngine::~ScriptEngine() {
+  m_threadVmPool.clear(m_vm);
   sq_close(m_vm);
 }
 
@@ -374,9 +450,14 @@ void ScriptEngine::executeNutScript(const std::string &name) {
 #endif
   auto top = sq_gettop(m_vm);
   sq_pushroottable(m_vm);
-  if (SQ_FAILED(sq_compilebuffer(m_vm, code.data(), code.size() - 1, _SC(name.data()), SQTrue))) {
-    error("Error compiling {}", name);
-    return;
+  auto hash = _getHash(code);
+  auto cachePath = std::filesystem::path(ScriptCacheDirectory) / (name + ".cnut");
+  if (!_loadCompiledScript(m_vm, cachePath, hash)) {
+    if (SQ_FAILED(sq_compilebuffer(m_vm, code.data(), code.size() - 1, _SC(name.data()), SQTrue))) {
+      error("Error compiling {}", name);
+      return;
+    }
+    _saveCompiledScript(m_vm, cachePath, hash);
   }
   sq_push(m_vm, -2);
   // call
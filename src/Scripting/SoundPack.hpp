@@ -156,7 +156,8 @@ private:
     if (!pSound) {
       return sq_throwerror(v, _SC("failed to get sound"));
     }
-    pSound->load();
+    // the sound is decoded in the background, it's ready or almost when it's played
+    g_pEngine->getSoundManager().preload(pSound);
     return 0;
   }
 
@@ -316,7 +317,10 @@ private:
     }
     auto pSound = EntityManager::getSound(v, 2);
     if (pSound) {
-      pSound->getSoundHandle()->get().setVolume(volume);
+      // a music waiting to be decoded has no handle yet
+      if (pSound->getSoundHandle()) {
+        pSound->getSoundHandle()->get().setVolume(volume);
+      }
       return 0;
     }
     auto pSoundDef = EntityManager::getSoundDefinition(v, 2);
@@ -1,4 +1,5 @@
 #pragma once
+#include <algorithm>
 #include <squirrel.h>
 #include "../../extlibs/squirrel/squirrel/sqpcheader.h"
 #include "../../extlibs/squirrel/squirrel/sqvm.h"
@@ -18,6 +19,8 @@
 #include <engge/Audio/SoundId.hpp>
 #include <engge/Audio/SoundManager.hpp>
 #include <engge/Engine/Thread.hpp>
+#include <engge/Engine/TimerQueue.hpp>
+#include <engge/Engine/WaitManager.hpp>
 #include <Engine/AchievementManager.hpp>
 #include "Util/Util.hpp"
 
@@ -73,150 +76,6 @@ private:
   int m_numFrames;
 };
 
-class BreakWhileAnimatingFunction final : public BreakFunction {
-private:
-  std::string m_name;
-  Actor &m_actor;
-  Animation *m_pAnimation;
-
-public:
-  BreakWhileAnimatingFunction(Engine &engine, int id, Actor &actor)
-      : BreakFunction(engine, id), m_actor(actor), m_pAnimation(actor.getCostume().getAnimation()) {
-    m_name = m_pAnimation->name;
-  }
-
-  [[nodiscard]] std::string getName() const override {
-    return "_BreakWhileAnimatingFunction " + m_name;
-  }
-
-  bool isElapsed() override {
-    auto animControl = m_actor.getCostume().getAnimControl();
-    return animControl.getAnimation() != m_pAnimation || animControl.getState() != AnimState::Play;
-  }
-};
-
-class BreakWhileAnimatingObjectFunction final : public BreakFunction {
-private:
-  Object &m_object;
-  std::optional<Animation *> m_animation;
-
-public:
-  BreakWhileAnimatingObjectFunction(Engine &engine, int id, Object &object)
-      : BreakFunction(engine, id), m_object(object), m_animation(object.getAnimation()) {
-  }
-
-  [[nodiscard]] std::string getName() const override {
-    return "_BreakWhileAnimatingObjectFunction";
-  }
-
-  bool isElapsed() override {
-    return !m_animation.has_value() || m_object.getAnimControl().getState() != AnimState::Play;
-  }
-};
-
-class BreakWhileWalkingFunction final : public BreakFunction {
-private:
-  Actor &m_actor;
-
-public:
-  explicit BreakWhileWalkingFunction(Engine &engine, int id, Actor &actor)
-      : BreakFunction(engine, id), m_actor(actor) {
-  }
-
-  [[nodiscard]] std::string getName() const override {
-    return "_BreakWhileWalkingFunction";
-  }
-
-  bool isElapsed() override {
-    return !m_actor.isWalking();
-  }
-};
-
-class BreakWhileTalkingFunction final : public BreakFunction {
-private:
-  Entity &m_entity;
-
-public:
-  explicit BreakWhileTalkingFunction(Engine &engine, int id, Entity &entity)
-      : BreakFunction(engine, id), m_entity(entity) {
-  }
-
-  [[nodiscard]] std::string getName() const override {
-    return "_BreakWhileTalkingFunction";
-  }
-
-  bool isElapsed() override {
-    return !m_entity.isTalking();
-  }
-};
-
-class BreakWhileAnyActorTalkingFunction final : public BreakFunction {
-public:
-  explicit BreakWhileAnyActorTalkingFunction(Engine &engine, int id)
-      : BreakFunction(engine, id) {
-  }
-
-  [[nodiscard]] std::string getName() const override {
-    return "_BreakWhileAnyActorTalkingFunction";
-  }
-
-  bool isElapsed() override {
-    for (auto &&actor : m_engine.getActors()) {
-      if (actor->isTalking())
-        return false;
-    }
-    return true;
-  }
-};
-
-class BreakWhileSoundFunction final : public BreakFunction {
-private:
-  int m_soundId;
-
-public:
-  BreakWhileSoundFunction(Engine &engine, int id, int soundId)
-      : BreakFunction(engine, id), m_soundId(soundId) {
-  }
-
-  [[nodiscard]] std::string getName() const override {
-    return "_BreakWhileSoundFunction";
-  }
-
-  bool isElapsed() override {
-    auto pSoundId = dynamic_cast<SoundId *>(EntityManager::getSoundFromId(m_soundId));
-    return !pSoundId || !pSoundId->isPlaying();
-  }
-};
-
-class BreakWhileRunningFunction final : public Function {
-private:
-  int m_currentThreadId, m_threadId;
-  bool m_done;
-
-public:
-  BreakWhileRunningFunction(int currentThreadId, int threadId)
-      : m_currentThreadId(currentThreadId), m_threadId(threadId), m_done(false) {
-  }
-
-  void operator()(const ngf::TimeSpan &) override {
-    if (m_done)
-      return;
-
-    auto pThread = EntityManager::getThreadFromId(m_threadId);
-    if (!pThread || pThread->isStopped()) {
-      auto pCurrentThread = EntityManager::getThreadFromId(m_currentThreadId);
-      if (pCurrentThread) {
-        pCurrentThread->resume();
-      }
-      m_done = true;
-    }
-  }
-
-  bool isElapsed() override {
-    return m_done;
-  }
-};
-
 class BreakWhileDialogFunction final : public BreakFunction {
 public:
   BreakWhileDialogFunction(Engine &engine, int id)
@@ -247,21 +106,6 @@ public:
   }
 };
 
-class BreakWhileCameraFunction final : public BreakFunction {
-public:
-  BreakWhileCameraFunction(Engine &engine, int id)
-      : BreakFunction(engine, id) {
-  }
-
-  [[nodiscard]] std::string getName() const override {
-    return "_BreakWhileCameraFunction";
-  }
-
-  bool isElapsed() override {
-    return !m_engine.getCamera().isMoving();
-  }
-};
-
 class BreakWhileInputOffFunction final : public BreakFunction {
 public:
   BreakWhileInputOffFunction(Engine &engine, int id)
@@ -277,29 +121,6 @@ public:
   }
 };
 
-class BreakTimeFunction final : public TimeFunction {
-private:
-  int m_threadId;
-
-public:
-  BreakTimeFunction(int id, const ngf::TimeSpan &time)
-      : TimeFunction(time), m_threadId(id) {
-  }
-
-  void operator()(const ngf::TimeSpan &elapsed) override {
-    if (m_done)
-      return;
-    TimeFunction::operator()(elapsed);
-    if (isElapsed()) {
-      m_done = true;
-      auto pThread = EntityManager::getThreadFromId(m_threadId);
-      if (!pThread)
-        return;
-      pThread->resume();
-    }
-  }
-};
-
 class SystemPack final : public Pack {
 private:
   static Engine *g_pEngine;
@@ -404,6 +225,15 @@ private:
     return 0;
   }
 
+  // suspends the current thread until the condition is true, it is checked only when the source notifies an event
+  static SQInteger breakUntil(HSQUIRRELVM v, WaitEvent event, int sourceId, WaitManager::Condition condition) {
+    auto pThread = EntityManager::getThreadFromVm(v);
+    pThread->suspend();
+
+    Locator<WaitManager>::get().wait(event, sourceId, pThread->getId(), std::move(condition));
+    return SQ_SUSPEND_FLAG;
+  }
+
   static SQInteger breakhere(HSQUIRRELVM v) {
     SQFloat numFrames;
     if (SQ_FAILED(sq_getfloat(v, 2, &numFrames))) {
@@ -423,30 +253,25 @@ private:
       if (!pAnim)
         return 0;
 
-      auto pThread = EntityManager::getThreadFromVm(v);
-      pThread->suspend();
-
-      g_pEngine->addFunction(std::make_unique<BreakWhileAnimatingFunction>(*g_pEngine, pThread->getId(), *pActor));
-      return SQ_SUSPEND_FLAG;
+      return breakUntil(v, WaitEvent::Animation, pActor->getId(), [pActor, pAnim] {
+        auto &animControl = pActor->getCostume().getAnimControl();
+        return animControl.getAnimation() != pAnim || animControl.getState() != AnimState::Play;
+      });
     }
 
     auto *pObj = EntityManager::getObject(v, 2);
     if (pObj) {
-      auto pThread = EntityManager::getThreadFromVm(v);
-      pThread->suspend();
-
-      g_pEngine->addFunction(std::make_unique<BreakWhileAnimatingObjectFunction>(*g_pEngine, pThread->getId(), *pObj));
-      return SQ_SUSPEND_FLAG;
+      return breakUntil(v, WaitEvent::Animation, pObj->getId(), [pObj] {
+        return pObj->getAnimControl().getState() != AnimState::Play;
+      });
     }
     return sq_throwerror(v, _SC("failed to get actor or object"));
   }
 
   static SQInteger breakwhilecamera(HSQUIRRELVM v) {
-    auto pThread = EntityManager::getThreadFromVm(v);
-    pThread->suspend();
-
-    g_pEngine->addFunction(std::make_unique<BreakWhileCameraFunction>(*g_pEngine, pThread->getId()));
-    return SQ_SUSPEND_FLAG;
+    return breakUntil(v, WaitEvent::Camera, 0, [] {
+      return !g_pEngine->getCamera().isMoving();
+    });
   }
 
   static SQInteger breakwhilecutscene(HSQUIRRELVM v) {
@@ -467,13 +292,11 @@ private:
 
   static SQInteger breakwhilesound(HSQUIRRELVM v) {
     SoundId *pSound = EntityManager::getSound(v, 2);
-    auto pThread = EntityManager::getThreadFromVm(v);
-    pThread->suspend();
-
-    g_pEngine->addFunction(std::make_unique<BreakWhileSoundFunction>(*g_pEngine,
-                                                                     pThread->getId(),
-                                                                      pSound ? pSound->getId() : 0));
-    return SQ_SUSPEND_FLAG;
+    auto soundId = pSound ? pSound->getId() : 0;
+    return breakUntil(v, WaitEvent::Sound, soundId, [soundId] {
+      auto pSoundId = dynamic_cast<SoundId *>(EntityManager::getSoundFromId(soundId));
+      return !pSoundId || !pSoundId->isPlaying();
+    });
   }
 
   static SQInteger breakwhiledialog(HSQUIRRELVM v) {
@@ -490,11 +313,9 @@ private:
       return sq_throwerror(v, _SC("failed to get actor"));
     }
 
-    auto pThread = EntityManager::getThreadFromVm(v);
-    pThread->suspend();
-
-    g_pEngine->addFunction(std::make_unique<BreakWhileWalkingFunction>(*g_pEngine, pThread->getId(), *pActor));
-    return SQ_SUSPEND_FLAG;
+    return breakUntil(v, WaitEvent::Walk, pActor->getId(), [pActor] {
+      return !pActor->isWalking();
+    });
   }
 
   static SQInteger breakwhiletalking(HSQUIRRELVM v) {
@@ -503,18 +324,17 @@ private:
       if (!pEntity) {
         return sq_throwerror(v, _SC("failed to get actor/object"));
       }
-      auto pThread = EntityManager::getThreadFromVm(v);
-      pThread->suspend();
-
-      g_pEngine->addFunction(std::make_unique<BreakWhileTalkingFunction>(*g_pEngine, pThread->getId(), *pEntity));
-      return SQ_SUSPEND_FLAG;
+      return breakUntil(v, WaitEvent::Talk, pEntity->getId(), [pEntity] {
+        return !pEntity->isTalking();
+      });
     }
 
-    auto pThread = EntityManager::getThreadFromVm(v);
-    pThread->suspend();
-
-    g_pEngine->addFunction(std::make_unique<BreakWhileAnyActorTalkingFunction>(*g_pEngine, pThread->getId()));
-    return SQ_SUSPEND_FLAG;
+    return breakUntil(v, WaitEvent::Talk, 0, [] {
+      const auto &actors = g_pEngine->getActors();
+      return std::none_of(actors.cbegin(), actors.cend(), [](const auto &pActor) {
+        return pActor->isTalking();
+      });
+    });
   }
 
   static SQInteger breakwhilerunning(HSQUIRRELVM v) {
@@ -533,9 +353,11 @@ private:
       if (!pThread)
         return 0;
 
-      pCurrentThread->suspend();
-      g_pEngine->addFunction(std::make_unique<BreakWhileRunningFunction>(pCurrentThread->getId(), id));
-      return SQ_SUSPEND_FLAG;
+      auto threadId = static_cast<int>(id);
+      return breakUntil(v, WaitEvent::Thread, threadId, [threadId] {
+        auto pRunningThread = EntityManager::getThreadFromId(threadId);
+        return !pRunningThread || pRunningThread->isStopped();
+      });
     }
     return breakwhilesound(v);
   }
@@ -838,15 +660,6 @@ private:
       return sq_throwerror(v, _SC("Couldn't get environment from stack"));
     }
 
-    auto vm = ScriptEngine::getVm();
-    // create thread and store it on the stack
-    sq_newthread(vm, 1024);
-    HSQOBJECT thread_obj;
-    sq_resetobject(&thread_obj);
-    if (SQ_FAILED(sq_getstackobj(vm, -1, &thread_obj))) {
-      return sq_throwerror(v, _SC("Couldn't get coroutine thread from stack"));
-    }
-
     std::vector<HSQOBJECT> args;
     for (auto i = 0; i < size - 2; i++) {
       HSQOBJECT arg;
@@ -873,8 +686,10 @@ private:
     std::string pSource = _stringval(_closure(closureObj)->_function->_sourcename);
     auto line = _closure(closureObj)->_function->_lineinfos->_line;
     threadName += ' ' + pSource + '(' + std::to_string(line) + ')';
+    // the thread VM is recycled once the thread ends
+    auto vm = ScriptEngine::getVm();
+    auto thread_obj = ScriptEngine::getThreadVmPool().acquire(vm);
     auto pUniquethread = std::make_unique<Thread>(threadName, global, vm, thread_obj, env_obj, closureObj, args);
-    sq_pop(vm, 1);
     auto pThread = pUniquethread.get();
     trace("start thread ({}): {}", threadName, pThread->getId());
     if (name) {
@@ -905,7 +720,13 @@ private:
 
     pThread->suspend();
 
-    g_pEngine->addFunction(std::make_unique<BreakTimeFunction>(pThread->getId(), ngf::TimeSpan::seconds(time)));
+    auto threadId = pThread->getId();
+    g_pEngine->getTimers().schedule(ngf::TimeSpan::seconds(time), [threadId] {
+      auto pSuspendedThread = EntityManager::getThreadFromId(threadId);
+      if (!pSuspendedThread)
+        return;
+      pSuspendedThread->resume();
+    });
     return SQ_SUSPEND_FLAG;
   }
 
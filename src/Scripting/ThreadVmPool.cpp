@@ -0,0 +1,64 @@
+#include <engge/Scripting/ThreadVmPool.hpp>
+#include "../../extlibs/squirrel/squirrel/sqpcheader.h"
+#include "../../extlibs/squirrel/squirrel/sqvm.h"
+
+namespace ng {
+HSQOBJECT ThreadVmPool::acquire(HSQUIRRELVM v) {
+  HSQOBJECT thread;
+  sq_resetobject(&thread);
+  if (!m_threads.empty()) {
+    thread = m_threads.back();
+    m_threads.pop_back();
+    m_reused++;
+    return thread;
+  }
+
+  sq_newthread(v, StackSize);
+  sq_getstackobj(v, -1, &thread);
+  sq_addref(v, &thread);
+  sq_pop(v, 1);
+  m_created++;
+  return thread;
+}
+
+void ThreadVmPool::release(HSQUIRRELVM v, HSQOBJECT &thread, bool hasFailed) {
+  // Squirrel unwinds the call stack of a failed coroutine, so its VM looks idle,
+  // it's discarded anyway in case the error left it in an unexpected state
+  if (!hasFailed && m_threads.size() < Capacity && canReuse(v, thread)) {
+    reset(v, thread);
+    m_threads.push_back(thread);
+  } else {
+    sq_release(v, &thread);
+    m_discarded++;
+  }
+  sq_resetobject(&thread);
+}
+
+void ThreadVmPool::clear(HSQUIRRELVM v) {
+  for (auto &thread : m_threads) {
+    sq_release(v, &thread);
+  }
+  m_threads.clear();
+}
+
+bool ThreadVmPool::canReuse(HSQUIRRELVM v, HSQOBJECT thread) {
+  if (sq_type(thread) != OT_THREAD)
+    return false;
+  auto pThread = _thread(thread);
+  // a suspended coroutine still has frames in its call stack
+  if (sq_getvmstate(pThread) != SQ_VMSTATE_IDLE || pThread->_callsstacksize != 0)
+    return false;
+  // the reference table holds a single reference to the thread whatever the number of sq_addref:
+  // a thread referenced by a script (e.g. a local variable) has more than this reference,
+  // a thread added again to the reference table (e.g. by a callback argument) has more than one ref count
+  return pThread->_uiRef == 1 && sq_getrefcount(v, &thread) == 1;
+}
+
+void ThreadVmPool::reset(HSQUIRRELVM v, HSQOBJECT thread) {
+  auto pThread = _thread(thread);
+  sq_settop(pThread, 0);
+  pThread->_lasterror.Null();
+  pThread->_roottable = v->_roottable;
+  pThread->_errorhandler = v->_errorhandler;
+}
+} // namespace ng
@@ -2,6 +2,7 @@
 #include <imgui.h>
 #include <engge/Dialog/DialogManager.hpp>
 #include <engge/Scripting/ScriptEngine.hpp>
+#include <engge/Scripting/ScriptExecute.hpp>
 #include <engge/Engine/Preferences.hpp>
 #include <engge/Engine/EntityManager.hpp>
 #include <engge/Engine/ThreadBase.hpp>
@@ -44,6 +45,14 @@ void GeneralTools::render() {
               ((dialogState == DialogManagerState::Active)
                ? "yes"
                : (dialogState == DialogManagerState::WaitingForChoice ? "waiting for choice" : "no")));
+  auto pScriptExecute = m_engine.getScriptExecute();
+  if (pScriptExecute) {
+    auto stats = pScriptExecute->getStats();
+    auto numExecutions = stats.hits + stats.misses;
+    ImGui::Text("Compiled code: %lu/%lu, %d hits, %d misses (hit rate: %.1f%%)",
+                stats.size, stats.capacity, stats.hits, stats.misses,
+                numExecutions ? 100.f * stats.hits / numExecutions : 0.f);
+  }
   ImGui::Separator();
 
   auto mousePos = m_engine.getMousePositionInRoom();
@@ -41,6 +41,25 @@ void PreferencesTools::render() {
   if (ImGui::SliderFloat("UI Backing Alpha", &uiBackingAlpha, 0.f, 100.f)) {
     m_engine.getPreferences().setUserPreference(PreferenceNames::UiBackingAlpha, uiBackingAlpha * 0.01f);
   }
+  auto nativeRoomResolution =
+      m_engine.getPreferences().getUserPreference(PreferenceNames::EnggeNativeRoomResolution,
+                                                 PreferenceDefaultValues::EnggeNativeRoomResolution);
+  if (ImGui::Checkbox("Native Room Resolution", &nativeRoomResolution)) {
+    m_engine.getPreferences().setUserPreference(PreferenceNames::EnggeNativeRoomResolution,
+                                                nativeRoomResolution ? 1 : 0);
+  }
+  auto textureMemoryBudget =
+      m_engine.getPreferences().getUserPreference(PreferenceNames::EnggeTextureMemoryBudget,
+                                                 PreferenceDefaultValues::EnggeTextureMemoryBudget);
+  if (ImGui::SliderInt("Texture Memory Budget (MB)", &textureMemoryBudget, 64, 2048)) {
+    m_engine.getPreferences().setUserPreference(PreferenceNames::EnggeTextureMemoryBudget, textureMemoryBudget);
+  }
+  auto soundMemoryBudget =
+      m_engine.getPreferences().getUserPreference(PreferenceNames::EnggeSoundMemoryBudget,
+                                                 PreferenceDefaultValues::EnggeSoundMemoryBudget);
+  if (ImGui::SliderInt("Sound Memory Budget (MB)", &soundMemoryBudget, 16, 512)) {
+    m_engine.getPreferences().setUserPreference(PreferenceNames::EnggeSoundMemoryBudget, soundMemoryBudget);
+  }
 }
 
 int PreferencesTools::getSelectedLang() {
@@ -72,6 +72,15 @@ void RoomTools::render() {
   if (ngf::ImGui::ColorEdit4("Overlay", &overlay)) {
     room->setOverlayColor(overlay);
   }
+  auto &lightingShader = room->getLightingShader();
+  ImGui::Text("Lighting uniforms: %d uploaded, %d skipped",
+              lightingShader.getIssuedUploads(), lightingShader.getSkippedUploads());
+  ImGui::SameLine();
+  if (ImGui::SmallButton("Reset")) {
+    lightingShader.resetUploadStats();
+  }
+  const auto &spriteBatch = room->getSpriteBatch();
+  ImGui::Text("Sprites: %d drawn, %d culled", spriteBatch.getDrawnSprites(), spriteBatch.getCulledSprites());
   auto ambient = room->getAmbientLight();
   if (ngf::ImGui::ColorEdit4("ambient", &ambient)) {
     room->setAmbientLight(ambient);
@@ -85,17 +94,20 @@ void RoomTools::render() {
 
     if (ImGui::TreeNode(ss.str().c_str())) {
       auto &light = room->getLights()[i];
-      ImGui::DragInt2("Position", &light.pos.x);
-      ngf::ImGui::ColorEdit4("Color", &light.color);
-      ImGui::DragFloat("Direction angle", &light.coneDirection,
-                       1.0f, 0.0f, 360.f);
-      ImGui::DragFloat("Angle", &light.coneAngle, 1.0f, 0.0f, 360.f);
-      ImGui::DragFloat("Cutoff", &light.cutOffRadius, 1.0f);
-      ImGui::DragFloat("Falloff", &light.coneFalloff, 0.1f, 0.f, 1.0f);
-      ImGui::DragFloat(
+      auto changed = ImGui::DragInt2("Position", &light.pos.x);
+      changed |= ngf::ImGui::ColorEdit4("Color", &light.color);
+      changed |= ImGui::DragFloat("Direction angle", &light.coneDirection,
+                                  1.0f, 0.0f, 360.f);
+      changed |= ImGui::DragFloat("Angle", &light.coneAngle, 1.0f, 0.0f, 360.f);
+      changed |= ImGui::DragFloat("Cutoff", &light.cutOffRadius, 1.0f);
+      changed |= ImGui::DragFloat("Falloff", &light.coneFalloff, 0.1f, 0.f, 1.0f);
+      changed |= ImGui::DragFloat(
           "Brightness", &light.brightness, 1.0f, 1.0f, 100.f);
-      ImGui::DragFloat(
+      changed |= ImGui::DragFloat(
           "Half Radius", &light.halfRadius, 1.0f, 0.01f, 0.99f);
+      if (changed) {
+        room->setLightsDirty();
+      }
       ImGui::TreePop();
     }
   }
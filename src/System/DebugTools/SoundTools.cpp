@@ -73,6 +73,13 @@ void SoundTools::render() {
 
   ImGui::Begin("Sounds", &soundsVisible);
   ImGui::Text("# sounds: %d/%lu", numSounds, sounds.size());
+  auto &soundManager = m_engine.getSoundManager();
+  ImGui::Text("Memory: %.1f/%.1f MB", soundManager.getSoundMemory() / (1024.f * 1024.f),
+              soundManager.getSoundBudget() / (1024.f * 1024.f));
+  auto numPlays = soundManager.getHits() + soundManager.getMisses();
+  ImGui::Text("Hits: %d, misses: %d (hit rate: %.1f%%)", soundManager.getHits(), soundManager.getMisses(),
+              numPlays ? 100.f * soundManager.getHits() / numPlays : 0.f);
+  ImGui::Text("Evicted: %d", soundManager.getEvictedSounds());
   ImGui::Separator();
 
   if (ImGui::BeginTable("Sounds",
@@ -9,13 +9,19 @@ void TextureTools::render() {
     return;
 
   ImGui::Begin("Textures", &texturesVisible);
-  const auto &map = Locator<ResourceManager>::get().getTextureMap();
+  const auto &resourceManager = Locator<ResourceManager>::get();
+  const auto &map = resourceManager.getTextureMap();
   size_t totalSize = 0;
   for (const auto&[key, value] :map) {
     totalSize += value.size;
   }
   auto totalSizeText = convertSize(totalSize);
   ImGui::Text("Total memory: %s", totalSizeText.data());
+  auto textureMemoryText = convertSize(resourceManager.getTextureMemory());
+  auto textureBudgetText = convertSize(resourceManager.getTextureBudget());
+  ImGui::Text("Video memory: %s / %s", textureMemoryText.data(), textureBudgetText.data());
+  ImGui::Text("Evicted: %d, reloaded: %d", resourceManager.getEvictedTextures(),
+              resourceManager.getReloadedTextures());
   ImGui::Separator();
 
   if (ImGui::BeginTable("Textures",
@@ -1,6 +1,9 @@
 #include "ThreadTools.hpp"
 #include <engge/Engine/Engine.hpp>
 #include <engge/Engine/ThreadBase.hpp>
+#include <engge/Engine/WaitManager.hpp>
+#include <engge/Scripting/ScriptEngine.hpp>
+#include <engge/System/Locator.hpp>
 #include <imgui.h>
 #include <string>
 
@@ -45,6 +48,13 @@ void ThreadTools::render() {
   const auto &threads = m_engine.getThreads();
   ImGui::Begin("Threads", &threadsVisible);
   ImGui::Text("# threads: %lu", threads.size());
+  ImGui::Text("# waiting for an event: %lu", Locator<WaitManager>::get().getNumWaits());
+  const auto &vmPool = ScriptEngine::getThreadVmPool();
+  auto numAcquired = vmPool.getCreated() + vmPool.getReused();
+  auto reuseRate = numAcquired == 0 ? 0.f : 100.f * static_cast<float>(vmPool.getReused()) / static_cast<float>(numAcquired);
+  ImGui::Text("VM pool: %lu/%lu, created: %lu, reused: %lu (%.1f%%), discarded: %lu",
+              vmPool.getSize(), ThreadVmPool::Capacity, vmPool.getCreated(), vmPool.getReused(), reuseRate,
+              vmPool.getDiscarded());
   ImGui::Separator();
 
   if (ImGui::BeginTable("Threads",
@@ -10,7 +10,7 @@ Logger::Logger() {
   console_sink->set_level(spdlog::level::trace);
   auto file_sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>("log.txt", true);
   file_sink->set_level(spdlog::level::trace);
-  auto dist_sink = std::make_shared<spdlog::sinks::dist_sink_st>();
+  auto dist_sink = std::make_shared<spdlog::sinks::dist_sink_mt>();
   dist_sink->add_sink(console_sink);
   dist_sink->add_sink(file_sink);
   m_out = std::make_shared<spdlog::logger>("log", dist_sink);
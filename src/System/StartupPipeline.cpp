@@ -0,0 +1,86 @@
+#include <algorithm>
+#include "engge/System/Locator.hpp"
+#include "engge/System/Logger.hpp"
+#include "engge/System/StartupPipeline.hpp"
+#include "engge/System/ThreadPool.hpp"
+
+namespace ng {
+namespace {
+long long toMilliseconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+}
+}
+
+StartupPipeline::StartupPipeline() : m_start(std::chrono::steady_clock::now()) {}
+
+void StartupPipeline::run(const std::string &name, std::function<void()> task) {
+  auto pTask = std::make_unique<Task>();
+  pTask->name = name;
+  auto pTaskRaw = pTask.get();
+  pTask->result = Locator<ThreadPool>::get().enqueue([this, pTaskRaw, task = std::move(task)] {
+    auto start = std::chrono::steady_clock::now();
+    task();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    pTaskRaw->start = start;
+    pTaskRaw->end = std::chrono::steady_clock::now();
+  }).share();
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_tasks.push_back(std::move(pTask));
+}
+
+void StartupPipeline::runOnMainThread(const std::string &name, const std::function<void()> &task) {
+  auto pTask = std::make_unique<Task>();
+  pTask->name = name;
+  pTask->mainThread = true;
+  pTask->start = std::chrono::steady_clock::now();
+  task();
+  pTask->end = std::chrono::steady_clock::now();
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_tasks.push_back(std::move(pTask));
+}
+
+void StartupPipeline::wait(const std::string &name) {
+  auto pTask = getTask(name);
+  if (pTask && !pTask->mainThread) {
+    pTask->result.get();
+  }
+}
+
+void StartupPipeline::waitAll() {
+  std::vector<std::shared_future<void>> results;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto &pTask : m_tasks) {
+      if (!pTask->mainThread) {
+        results.push_back(pTask->result);
+      }
+    }
+  }
+  for (const auto &result : results) {
+    result.get();
+  }
+}
+
+void StartupPipeline::logTimings() {
+  waitAll();
+  auto end = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (const auto &pTask : m_tasks) {
+    info("Startup task '{}' ({}): {} ms, started at {} ms", pTask->name,
+         pTask->mainThread ? "main thread" : "worker",
+         toMilliseconds(pTask->end - pTask->start),
+         toMilliseconds(pTask->start - m_start));
+  }
+  info("Time to first frame: {} ms", toMilliseconds(end - m_start));
+}
+
+StartupPipeline::Task *StartupPipeline::getTask(const std::string &name) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = std::find_if(m_tasks.begin(), m_tasks.end(), [&name](const auto &pTask) {
+    return pTask->name == name;
+  });
+  return it == m_tasks.end() ? nullptr : it->get();
+}
+} // namespace ng
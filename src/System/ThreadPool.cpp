@@ -0,0 +1,40 @@
+#include <algorithm>
+#include "engge/System/ThreadPool.hpp"
+
+namespace ng {
+ThreadPool::ThreadPool() {
+  auto count = std::max(2u, std::thread::hardware_concurrency()) - 1;
+  for (auto i = 0u; i < count; ++i) {
+    m_workers.emplace_back([this] { run(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+    m_jobs.clear();
+    m_lowPriorityJobs.clear();
+  }
+  m_condition.notify_all();
+  for (auto &worker : m_workers) {
+    worker.join();
+  }
+}
+
+void ThreadPool::run() {
+  while (true) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_condition.wait(lock, [this] { return m_stop || !m_jobs.empty() || !m_lowPriorityJobs.empty(); });
+      if (m_stop)
+        return;
+      auto &jobs = m_jobs.empty() ? m_lowPriorityJobs : m_jobs;
+      job = std::move(jobs.front());
+      jobs.pop_front();
+    }
+    job();
+  }
+}
+} // namespace ng
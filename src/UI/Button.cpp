@@ -7,6 +7,7 @@
 #include <ngf/Graphics/FntFont.h>
 #include "ControlConstants.hpp"
 #include "Util/Util.hpp"
+#include <engge/Graphics/UIResourceNames.hpp>
 
 namespace ng {
 Button::Button(int id, float y, Callback callback, bool enabled, Size size)
@@ -28,7 +29,7 @@ void Button::draw(ngf::RenderTarget &target, ngf::RenderStates states) const {
 
 void Button::onEngineSet() {
   const auto &uiFontLargeOrMedium =
-      m_pEngine->getResourceManager().getFntFont(m_size == Size::Large ? "UIFontLarge.fnt" : "UIFontMedium.fnt");
+      m_pEngine->getResourceManager().getFntFont(m_size == Size::Large ? UIResourceNames::UIFontLarge : UIResourceNames::UIFontMedium);
   m_text.setFont(uiFontLargeOrMedium);
   m_text.setWideString(ng::Engine::getText(m_id));
   auto textRect = m_text.getLocalBounds();
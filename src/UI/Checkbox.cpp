@@ -4,6 +4,7 @@
 #include "ControlConstants.hpp"
 #include <ngf/Graphics/FntFont.h>
 #include <ngf/System/Mouse.h>
+#include <engge/Graphics/UIResourceNames.hpp>
 
 namespace ng {
 Checkbox::Checkbox(int id, float y, bool enabled, bool checked, Callback callback)
@@ -16,7 +17,7 @@ void Checkbox::draw(ngf::RenderTarget &target, ngf::RenderStates states) const {
 }
 
 void Checkbox::onEngineSet() {
-  const auto &uiFontMedium = m_pEngine->getResourceManager().getFntFont("UIFontMedium.fnt");
+  const auto &uiFontMedium = m_pEngine->getResourceManager().getFntFont(UIResourceNames::UIFontMedium);
   m_text.setFont(uiFontMedium);
   m_text.setWideString(ng::Engine::getText(m_id));
   auto textRect = m_text.getLocalBounds();
@@ -31,7 +32,8 @@ void Checkbox::setSpriteSheet(SpriteSheet *pSpriteSheet) {
   glm::vec2 scale(Screen::Width / 320.f, Screen::Height / 180.f);
   m_sprite.getTransform().setScale(scale);
   m_sprite.getTransform().setOrigin({checkedRect.getWidth() / 2.f, checkedRect.getHeight() / 2.f});
-  m_sprite.setTexture(*pSpriteSheet->getTexture());
+  m_texture = pSpriteSheet->getTexture();
+  m_sprite.setTexture(*m_texture);
   m_sprite.setTextureRect(checkedRect);
 
   updateCheckState();
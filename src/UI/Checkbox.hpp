@@ -1,4 +1,5 @@
 #pragma once
+#include <memory>
 #include <utility>
 #include <ngf/Graphics/Drawable.h>
 #include <ngf/Graphics/Sprite.h>
@@ -32,6 +33,7 @@ private:
   float m_y{0};
   bool m_isChecked{false};
   ng::Text m_text;
+  std::shared_ptr<ngf::Texture> m_texture; ///< keeps the texture of the sprite from being evicted
   ngf::Sprite m_sprite;
   SpriteSheet *m_pSpriteSheet{nullptr};
 };
@@ -9,6 +9,7 @@
 #include <ngf/System/Mouse.h>
 #include <utility>
 #include "Util/Util.hpp"
+#include <engge/Graphics/UIResourceNames.hpp>
 
 namespace ng {
 
@@ -70,7 +71,7 @@ private:
 
   void onEngineSet() final {
     const auto &uiFontLargeOrMedium =
-        m_pEngine->getResourceManager().getFntFont(m_size == Size::Large ? "UIFontLarge.fnt" : "UIFontMedium.fnt");
+        m_pEngine->getResourceManager().getFntFont(m_size == Size::Large ? UIResourceNames::UIFontLarge : UIResourceNames::UIFontMedium);
     m_text.setFont(uiFontLargeOrMedium);
     m_text.setWideString(ng::Engine::getText(m_id));
     m_text.getTransform().setPosition(m_pos);
@@ -103,6 +104,8 @@ struct HelpDialog::Impl {
   HelpButton m_prev;
   HelpButton m_next;
   std::vector<int> m_pages;
+  std::shared_ptr<ngf::Texture> m_backgroundTexture; ///< keeps the texture of the sprite from being evicted
+  std::shared_ptr<ngf::Texture> m_helpPageTexture;
   ngf::Sprite m_backgroundSprite;
   ngf::Sprite m_helpPageSprite;
   int m_pageIndex{0};
@@ -135,7 +138,8 @@ struct HelpDialog::Impl {
     m_prev.setEngine(pEngine);
     m_next.setEngine(pEngine);
 
-    m_backgroundSprite.setTexture(*m_pEngine->getResourceManager().getTexture("HelpScreen_bg"));
+    m_backgroundTexture = m_pEngine->getResourceManager().getTexture("HelpScreen_bg");
+    m_backgroundSprite.setTexture(*m_backgroundTexture);
     m_backgroundSprite.getTransform().setPosition({Screen::HalfWidth, Screen::HalfHeight});
     m_backgroundSprite.setAnchor(ngf::Anchor::Center);
 
@@ -158,7 +162,8 @@ struct HelpDialog::Impl {
     sprintf(background, "HelpScreen_%02d_en", m_pages[index]);
     std::string backgroundWithLang = background;
     checkLanguage(backgroundWithLang);
-    m_helpPageSprite.setTexture(*m_pEngine->getResourceManager().getTexture(backgroundWithLang));
+    m_helpPageTexture = m_pEngine->getResourceManager().getTexture(backgroundWithLang);
+    m_helpPageSprite.setTexture(*m_helpPageTexture);
     m_helpPageSprite.setAnchor(ngf::Anchor::Center);
   }
 
@@ -18,6 +18,7 @@
 #include <ngf/Graphics/FntFont.h>
 #include <ngf/Graphics/RectangleShape.h>
 #include <ngf/System/Mouse.h>
+#include <engge/Graphics/UIResourceNames.hpp>
 
 namespace ng {
 struct OptionsDialog::Impl {
@@ -364,9 +365,9 @@ struct OptionsDialog::Impl {
 
     auto &tm = pEngine->getResourceManager();
     m_saveLoadSheet.setTextureManager(&tm);
-    m_saveLoadSheet.load("SaveLoadSheet");
+    m_saveLoadSheet.load(UIResourceNames::SaveLoadSheet);
 
-    const auto &headingFont = m_pEngine->getResourceManager().getFntFont("HeadingFont.fnt");
+    const auto &headingFont = m_pEngine->getResourceManager().getFntFont(UIResourceNames::HeadingFont);
     m_headingText.setFont(headingFont);
     m_headingText.setColor(ngf::Colors::White);
 
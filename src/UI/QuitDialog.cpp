@@ -11,6 +11,7 @@
 #include <ngf/Graphics/Sprite.h>
 #include <ngf/System/Mouse.h>
 #include "Util/Util.hpp"
+#include <engge/Graphics/UIResourceNames.hpp>
 
 namespace ng {
 class BackButton final : public Control {
@@ -32,7 +33,7 @@ public:
   }
 
   void onEngineSet() final {
-    m_text.setFont(m_pEngine->getResourceManager().getFntFont("UIFontLarge.fnt"));
+    m_text.setFont(m_pEngine->getResourceManager().getFntFont(UIResourceNames::UIFontLarge));
     m_text.setWideString(Engine::getText(m_id));
     auto textRect = m_text.getLocalBounds();
     auto originX = m_value ? textRect.getWidth() : 0;
@@ -117,9 +118,9 @@ struct QuitDialog::Impl {
       return;
 
     m_saveLoadSheet.setTextureManager(&pEngine->getResourceManager());
-    m_saveLoadSheet.load("SaveLoadSheet");
+    m_saveLoadSheet.load(UIResourceNames::SaveLoadSheet);
 
-    auto &headingFont = m_pEngine->getResourceManager().getFntFont("UIFontMedium.fnt");
+    auto &headingFont = m_pEngine->getResourceManager().getFntFont(UIResourceNames::UIFontMedium);
     m_headingText.setFont(headingFont);
     m_headingText.setColor(ngf::Colors::White);
 
@@ -16,6 +16,7 @@
 #include "Button.hpp"
 #include "ControlConstants.hpp"
 #include "Util/Util.hpp"
+#include <engge/Graphics/UIResourceNames.hpp>
 
 namespace ng {
 struct SaveLoadDialog::Impl {
@@ -36,7 +37,7 @@ struct SaveLoadDialog::Impl {
     }
 
     void onEngineSet() final {
-      m_text.setFont(m_pEngine->getResourceManager().getFntFont("UIFontLarge.fnt"));
+      m_text.setFont(m_pEngine->getResourceManager().getFntFont(UIResourceNames::UIFontLarge));
       m_text.setWideString(Engine::getText(BackId));
       auto textRect = ng::getGlobalBounds(m_text);
       m_text.getTransform().setOrigin({textRect.getWidth() / 2.f, textRect.getHeight() / 2.f});
@@ -92,7 +93,7 @@ struct SaveLoadDialog::Impl {
 
       m_transform.setPosition(pos);
 
-      const auto &uiFontSmallBold = engine.getResourceManager().getFntFont("UIFontSmallBold.fnt");
+      const auto &uiFontSmallBold = engine.getResourceManager().getFntFont(UIResourceNames::UIFontSmallBold);
 
       // prepare the text for the game time
       m_gameTimeText.setWideString(slot.getGameTimeString());
@@ -122,7 +123,8 @@ struct SaveLoadDialog::Impl {
 
       // prepare the sprite for the frame
       auto rect = spriteSheet.getRect("saveload_slot_frame");
-      m_sprite.setTexture(*spriteSheet.getTexture());
+      m_sheetTexture = spriteSheet.getTexture();
+      m_sprite.setTexture(*m_sheetTexture);
       m_sprite.getTransform().setOrigin({static_cast<float>(rect.getWidth() / 2.f),
                                          static_cast<float>(rect.getHeight() / 2.f)});
       m_sprite.getTransform().setScale({4, 4});
@@ -149,7 +151,7 @@ struct SaveLoadDialog::Impl {
 
       // or prepare a sprite for the savegame empty slot
       auto saveslotRect = spriteSheet.getRect("saveload_slot");
-      m_spriteImg.setTexture(*spriteSheet.getTexture());
+      m_spriteImg.setTexture(*m_sheetTexture);
       m_spriteImg.setTextureRect(saveslotRect);
       m_spriteImg.getTransform().setOrigin({static_cast<float>(saveslotRect.getWidth() / 2.f),
                                             static_cast<float>(saveslotRect.getHeight() / 2.f)});
@@ -180,6 +182,7 @@ struct SaveLoadDialog::Impl {
     int m_index{0};
     bool m_isEmpty{true};
     ngf::Texture m_texture;
+    std::shared_ptr<ngf::Texture> m_sheetTexture; ///< keeps the texture of the sprites from being evicted
     ngf::Sprite m_sprite, m_spriteImg;
     ng::Text m_gameTimeText;
     ng::Text m_saveTimeText;
@@ -233,9 +236,9 @@ struct SaveLoadDialog::Impl {
 
     ResourceManager &tm = pEngine->getResourceManager();
     m_saveLoadSheet.setTextureManager(&tm);
-    m_saveLoadSheet.load("SaveLoadSheet");
+    m_saveLoadSheet.load(UIResourceNames::SaveLoadSheet);
 
-    auto &headingFont = m_pEngine->getResourceManager().getFntFont("HeadingFont.fnt");
+    auto &headingFont = m_pEngine->getResourceManager().getFntFont(UIResourceNames::HeadingFont);
     m_headingText.setFont(headingFont);
     m_headingText.setColor(ngf::Colors::White);
   }
@@ -6,6 +6,7 @@
 #include <ngf/Graphics/RenderStates.h>
 #include <ngf/Graphics/RenderTarget.h>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <glm/vec2.hpp>
 #include "UI/Control.hpp"
@@ -30,6 +31,7 @@ private:
   float m_y{0};
   float m_min{0}, m_max{0}, m_value{0};
   bool m_isDragging{false};
+  std::shared_ptr<ngf::Texture> m_texture; ///< keeps the texture of the sprites from being evicted
   ngf::Sprite m_sprite;
   ngf::Sprite m_spriteHandle;
   ng::Text m_text;
@@ -5,6 +5,7 @@
 #include "ControlConstants.hpp"
 #include <ngf/System/Mouse.h>
 #include <imgui.h>
+#include <engge/Graphics/UIResourceNames.hpp>
 
 namespace ng {
 SwitchButton::SwitchButton(std::initializer_list<int> ids,
@@ -17,7 +18,7 @@ void SwitchButton::draw(ngf::RenderTarget &target, ngf::RenderStates states) con
 }
 
 void SwitchButton::onEngineSet() {
-  auto &uiFontMedium = m_pEngine->getResourceManager().getFntFont("UIFontMedium.fnt");
+  auto &uiFontMedium = m_pEngine->getResourceManager().getFntFont(UIResourceNames::UIFontMedium);
   m_text.setFont(uiFontMedium);
   m_text.setWideString(Engine::getText(m_ids[m_index]));
   auto textRect = m_text.getLocalBounds();